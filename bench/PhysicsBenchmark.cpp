@@ -0,0 +1,155 @@
+// Measures b2World_Step time against body count and thread count.
+//
+// Each run drops a grid of boxes and circles into a walled pit so most bodies
+// end up in contact piles (the expensive case), warms up, then times a fixed
+// number of steps. Threads = 1 is Box2D's single-threaded path; N > 1 runs the
+// solver on a JobSystem with N - 1 workers through PhysicsTasks, as the game does.
+//
+//   physics_bench [--steps=N] [--bodies=a,b,...] [--threads=a,b,...]
+#include "JobSystem.h"
+#include "PhysicsTasks.h"
+#include <box2d/box2d.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+std::vector<int> parseList(const char* text) {
+    std::vector<int> values;
+    while (*text) {
+        values.push_back(std::atoi(text));
+        const char* comma = std::strchr(text, ',');
+        if (!comma) break;
+        text = comma + 1;
+    }
+    return values;
+}
+
+void addWall(b2WorldId world, float x, float y, float halfWidth, float halfHeight) {
+    b2BodyDef bodyDef = b2DefaultBodyDef();
+    bodyDef.position = {x, y};
+    b2BodyId body = b2CreateBody(world, &bodyDef);
+    b2ShapeDef shapeDef = b2DefaultShapeDef();
+    b2Polygon box = b2MakeBox(halfWidth, halfHeight);
+    b2CreatePolygonShape(body, &shapeDef, &box);
+}
+
+void buildScene(b2WorldId world, int bodyCount) {
+    // Pit wide enough that the pile settles a few dozen bodies deep
+    const int columns = std::max(20, static_cast<int>(std::sqrt(static_cast<float>(bodyCount)) * 2.0f));
+    const float spacing = 1.1f;
+    const float halfWidth = columns * spacing * 0.5f + 1.0f;
+    addWall(world, 0.0f, -1.0f, halfWidth + 1.0f, 1.0f);
+    addWall(world, -halfWidth - 1.0f, 100.0f, 1.0f, 100.0f);
+    addWall(world, halfWidth + 1.0f, 100.0f, 1.0f, 100.0f);
+
+    b2ShapeDef shapeDef = b2DefaultShapeDef();
+    b2Polygon box = b2MakeBox(0.45f, 0.45f);
+    b2Circle circle = {{0.0f, 0.0f}, 0.45f};
+    for (int i = 0; i < bodyCount; ++i) {
+        int column = i % columns;
+        int row = i / columns;
+        b2BodyDef bodyDef = b2DefaultBodyDef();
+        bodyDef.type = b2_dynamicBody;
+        bodyDef.position = {(column - columns * 0.5f) * spacing + 0.5f, 1.0f + row * spacing};
+        b2BodyId body = b2CreateBody(world, &bodyDef);
+        if (i % 2 == 0) {
+            b2CreatePolygonShape(body, &shapeDef, &box);
+        } else {
+            b2CreateCircleShape(body, &shapeDef, &circle);
+        }
+    }
+}
+
+struct RunResult {
+    double meanMs = 0.0;
+    double p95Ms = 0.0;
+};
+
+RunResult runOnce(int bodyCount, int threadCount, int steps) {
+    JobSystem::getInstance().start(threadCount - 1);
+
+    b2WorldDef worldDef = b2DefaultWorldDef();
+    worldDef.gravity = {0.0f, -10.0f};
+    PhysicsTasks::getInstance().configure(worldDef);
+    b2WorldId world = b2CreateWorld(&worldDef);
+    buildScene(world, bodyCount);
+
+    const float timeStep = 1.0f / 60.0f;
+    const int subSteps = 4;  // same as Engine::update
+    for (int i = 0; i < 120; ++i) {
+        b2World_Step(world, timeStep, subSteps);
+        PhysicsTasks::getInstance().endStep();
+    }
+
+    std::vector<double> samples;
+    samples.reserve(steps);
+    for (int i = 0; i < steps; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        b2World_Step(world, timeStep, subSteps);
+        auto end = std::chrono::steady_clock::now();
+        PhysicsTasks::getInstance().endStep();
+        samples.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    b2DestroyWorld(world);
+    JobSystem::getInstance().shutdown();
+
+    RunResult result;
+    for (double sample : samples) result.meanMs += sample;
+    result.meanMs /= samples.size();
+    std::sort(samples.begin(), samples.end());
+    result.p95Ms = samples[std::min(samples.size() - 1, samples.size() * 95 / 100)];
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int steps = 300;
+    std::vector<int> bodyCounts = {500, 1000, 2000, 4000, 8000};
+    std::vector<int> threadCounts;
+
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (std::strncmp(arg, "--steps=", 8) == 0) {
+            steps = std::max(1, std::atoi(arg + 8));
+        } else if (std::strncmp(arg, "--bodies=", 9) == 0) {
+            bodyCounts = parseList(arg + 9);
+        } else if (std::strncmp(arg, "--threads=", 10) == 0) {
+            threadCounts = parseList(arg + 10);
+        } else {
+            std::fprintf(stderr, "Ignoring unknown argument '%s'\n", arg);
+        }
+    }
+    if (threadCounts.empty()) {
+        // Powers of two up to the hardware thread count
+        int hardware = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        for (int threads = 1; threads <= hardware; threads *= 2) {
+            threadCounts.push_back(threads);
+        }
+    }
+
+    std::printf("b2World_Step, %d steps, 4 substeps (mean / p95 ms, speedup vs the first thread count)\n", steps);
+    std::printf("%8s %8s %10s %10s %8s\n", "bodies", "threads", "mean", "p95", "speedup");
+    for (int bodies : bodyCounts) {
+        if (bodies <= 0) continue;
+        double baseline = 0.0;
+        for (int threads : threadCounts) {
+            threads = std::clamp(threads, 1, PhysicsTasks::MaxWorkers);
+            RunResult result = runOnce(bodies, threads, steps);
+            if (baseline == 0.0) baseline = result.meanMs;
+            std::printf("%8d %8d %10.3f %10.3f %7.2fx\n", bodies, threads, result.meanMs, result.p95Ms,
+                        baseline / result.meanMs);
+            std::fflush(stdout);
+        }
+    }
+    return 0;
+}
@@ -1,8 +1,11 @@
 #include "AssetManager.h"
 #include "Engine.h"
+#include "JobSystem.h"
 #include <SDL2/SDL_image.h>
 #include <tinyxml2.h>
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 AssetManager& AssetManager::getInstance() {
     static AssetManager instance;
@@ -24,32 +27,67 @@ bool AssetManager::loadFromXML(const std::string& filepath) {
     
     tinyxml2::XMLElement* texturesElement = root->FirstChildElement("textures");
     if (texturesElement) {
+        AtlasSettings atlas;
+        if (tinyxml2::XMLElement* atlasElement = texturesElement->FirstChildElement("atlas")) {
+            atlas.enabled = atlasElement->BoolAttribute("enabled", true);
+            atlasElement->QueryIntAttribute("pageSize", &atlas.pageSize);
+            atlasElement->QueryIntAttribute("padding", &atlas.padding);
+            atlasElement->QueryIntAttribute("maxEntrySize", &atlas.maxEntrySize);
+        }
+        
+        std::vector<PendingTexture> pending;
         for (tinyxml2::XMLElement* textureElement = texturesElement->FirstChildElement("texture");
              textureElement != nullptr;
              textureElement = textureElement->NextSiblingElement("texture")) {
             
             const char* id = textureElement->Attribute("id");
             const char* path = textureElement->Attribute("path");
-            
             if (id && path) {
-                SDL_Surface* surface = IMG_Load(path);
-                if (surface) {
-                    SDL_Texture* texture = SDL_CreateTextureFromSurface(
-                        Engine::getInstance().getRenderer(), surface);
-                    SDL_FreeSurface(surface);
-                    
-                    if (texture) {
-                        textures[id] = texture;
-                        std::cout << "Loaded texture: " << id << " from " << path << std::endl;
-                    }
-                }
+                // Tiled backgrounds and the like opt out with atlas="false"
+                pending.push_back({id, path, textureElement->BoolAttribute("atlas", true)});
+            }
+        }
+        
+        // Decode image files in parallel; textures are created on this thread afterwards
+        // since the renderer is not thread-safe
+        JobSystem::getInstance().parallelFor(pending.size(), 1, [&pending](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                pending[i].surface = IMG_Load(pending[i].path);
+            }
+        });
+        
+        for (const PendingTexture& entry : pending) {
+            if (entry.surface) textureSizes[entry.id] = { entry.surface->w, entry.surface->h };
+        }
+        
+        // Headless runs only need dimensions (for aspect-correct sprite sizing)
+        SDL_Renderer* renderer = Engine::getInstance().getRenderer();
+        if (renderer && atlas.enabled) {
+            packAtlas(renderer, pending, atlas);
+        }
+        
+        for (PendingTexture& entry : pending) {
+            SDL_Surface* surface = entry.surface;
+            if (!surface) continue;
+            
+            SDL_Texture* texture = renderer ? SDL_CreateTextureFromSurface(renderer, surface) : nullptr;
+            if (texture) {
+                TextureRegion region;
+                region.texture = texture;
+                region.source = {0, 0, surface->w, surface->h};
+                textures[entry.id] = region;
+                std::cout << "Loaded texture: " << entry.id << " from " << entry.path << std::endl;
+            } else if (!renderer) {
+                std::cout << "Loaded texture size: " << entry.id << " from " << entry.path << std::endl;
             }
+            SDL_FreeSurface(surface);
+            entry.surface = nullptr;
         }
     }
     
-    // Load sounds
+    // Load sounds (audio is not opened in headless mode)
     tinyxml2::XMLElement* soundsElement = root->FirstChildElement("sounds");
-    if (soundsElement) {
+    if (soundsElement && !Engine::getInstance().isHeadless()) {
         for (tinyxml2::XMLElement* soundElement = soundsElement->FirstChildElement("sound");
              soundElement != nullptr;
              soundElement = soundElement->NextSiblingElement("sound")) {
@@ -73,18 +111,122 @@ bool AssetManager::loadFromXML(const std::string& filepath) {
     return true;
 }
 
-SDL_Texture* AssetManager::getTexture(const std::string& id) {
+void AssetManager::packAtlas(SDL_Renderer* renderer, std::vector<PendingTexture>& pending, AtlasSettings settings) {
+    // Pages cannot exceed what the renderer can hold in one texture
+    SDL_RendererInfo info;
+    if (SDL_GetRendererInfo(renderer, &info) == 0 && info.max_texture_width > 0 && info.max_texture_height > 0) {
+        settings.pageSize = std::min({settings.pageSize, info.max_texture_width, info.max_texture_height});
+    }
+    
+    std::vector<size_t> candidates;
+    for (size_t i = 0; i < pending.size(); ++i) {
+        const SDL_Surface* surface = pending[i].surface;
+        if (!surface || !pending[i].allowAtlas) continue;
+        if (surface->w > settings.maxEntrySize || surface->h > settings.maxEntrySize) continue;
+        if (surface->w + settings.padding > settings.pageSize || surface->h + settings.padding > settings.pageSize) continue;
+        candidates.push_back(i);
+    }
+    
+    // Tallest first keeps the skyline flat, which packs noticeably tighter
+    std::sort(candidates.begin(), candidates.end(), [&pending](size_t a, size_t b) {
+        return pending[a].surface->h > pending[b].surface->h;
+    });
+    
+    struct Placement {
+        size_t entry;
+        SDL_Point position;
+    };
+    struct Page {
+        SkylinePacker packer;
+        std::vector<Placement> placements;
+    };
+    std::vector<Page> pages;
+    for (size_t index : candidates) {
+        const SDL_Surface* surface = pending[index].surface;
+        SDL_Point position;
+        bool placed = false;
+        for (Page& page : pages) {
+            if (page.packer.insert(surface->w + settings.padding, surface->h + settings.padding, position)) {
+                page.placements.push_back({index, position});
+                placed = true;
+                break;
+            }
+        }
+        if (!placed) {
+            pages.push_back({SkylinePacker(settings.pageSize, settings.pageSize), {}});
+            pages.back().packer.insert(surface->w + settings.padding, surface->h + settings.padding, position);
+            pages.back().placements.push_back({index, position});
+        }
+    }
+    
+    int packedCount = 0;
+    for (const Page& page : pages) {
+        // A page holding a single image saves no binds; leave it standalone
+        if (page.placements.size() < 2) continue;
+        
+        // Trim the unused margin; new surfaces start fully transparent
+        const int pageWidth = page.packer.getUsedWidth();
+        const int pageHeight = page.packer.getUsedHeight();
+        SDL_Surface* pageSurface = SDL_CreateRGBSurfaceWithFormat(0, pageWidth, pageHeight, 32, SDL_PIXELFORMAT_RGBA32);
+        if (!pageSurface) {
+            std::cerr << "Failed to create atlas page: " << SDL_GetError() << std::endl;
+            continue;
+        }
+        for (const Placement& placement : page.placements) {
+            SDL_Surface* surface = pending[placement.entry].surface;
+            SDL_Rect destination = {placement.position.x, placement.position.y, surface->w, surface->h};
+            SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);  // copy alpha as-is
+            SDL_BlitSurface(surface, nullptr, pageSurface, &destination);
+        }
+        SDL_Texture* pageTexture = SDL_CreateTextureFromSurface(renderer, pageSurface);
+        SDL_FreeSurface(pageSurface);
+        if (!pageTexture) {
+            std::cerr << "Failed to create atlas page texture: " << SDL_GetError() << std::endl;
+            continue;
+        }
+        atlasPages.push_back(pageTexture);
+        
+        for (const Placement& placement : page.placements) {
+            PendingTexture& entry = pending[placement.entry];
+            TextureRegion region;
+            region.texture = pageTexture;
+            region.source = {placement.position.x, placement.position.y, entry.surface->w, entry.surface->h};
+            region.uv = {
+                static_cast<float>(region.source.x) / pageWidth,
+                static_cast<float>(region.source.y) / pageHeight,
+                static_cast<float>(region.source.w) / pageWidth,
+                static_cast<float>(region.source.h) / pageHeight
+            };
+            region.atlased = true;
+            textures[entry.id] = region;
+            std::cout << "Loaded texture: " << entry.id << " from " << entry.path
+                      << " (atlas page " << atlasPages.size() - 1 << ")" << std::endl;
+            
+            SDL_FreeSurface(entry.surface);
+            entry.surface = nullptr;
+            ++packedCount;
+        }
+        std::cout << "Atlas page " << atlasPages.size() - 1 << ": " << pageWidth << "x" << pageHeight
+                  << ", " << page.placements.size() << " textures" << std::endl;
+    }
+    if (packedCount > 0) {
+        std::cout << "Packed " << packedCount << " textures into " << atlasPages.size() << " atlas page(s)" << std::endl;
+    }
+}
+
+TextureRegion AssetManager::getTexture(const std::string& id) const {
     auto it = textures.find(id);
     if (it != textures.end()) {
         return it->second;
     }
-    return nullptr;
+    return TextureRegion();
 }
 
 bool AssetManager::getTextureDimensions(const std::string& id, int& width, int& height) {
-    SDL_Texture* texture = getTexture(id);
-    if (texture) {
-        SDL_QueryTexture(texture, nullptr, nullptr, &width, &height);
+    auto it = textureSizes.find(id);
+    if (it != textureSizes.end()) {
+        width = it->second.x;
+        height = it->second.y;
         return true;
     }
     return false;
@@ -132,11 +274,17 @@ void AssetManager::setVolume(const std::string& id, int volume) {
 
 void AssetManager::clean() {
     for (auto& pair : textures) {
-        if (pair.second) {
-            SDL_DestroyTexture(pair.second);
+        // Atlas pages are shared, so they are destroyed once below
+        if (pair.second.texture && !pair.second.atlased) {
+            SDL_DestroyTexture(pair.second.texture);
         }
     }
     textures.clear();
+    for (SDL_Texture* page : atlasPages) {
+        SDL_DestroyTexture(page);
+    }
+    atlasPages.clear();
+    textureSizes.clear();
     
     for (auto& pair : sounds) {
         if (pair.second) {
@@ -1,6 +1,8 @@
 #pragma once
+#include "TextureAtlas.h"
 #include <string>
 #include <map>
+#include <vector>
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_mixer.h>
 
@@ -9,7 +11,9 @@ public:
     static AssetManager& getInstance();
     
     bool loadFromXML(const std::string& filepath);
-    SDL_Texture* getTexture(const std::string& id);
+    // Texture and source rectangle for an image; small images listed under
+    // <textures><atlas> share atlas pages. Empty region if the id is unknown.
+    TextureRegion getTexture(const std::string& id) const;
     bool getTextureDimensions(const std::string& id, int& width, int& height);
     
     // Audio support
@@ -34,7 +38,27 @@ private:
     AssetManager(const AssetManager&) = delete;
     AssetManager& operator=(const AssetManager&) = delete;
     
-    std::map<std::string, SDL_Texture*> textures;
+    struct PendingTexture {
+        const char* id;
+        const char* path;
+        bool allowAtlas = true;
+        SDL_Surface* surface = nullptr;
+    };
+    
+    struct AtlasSettings {
+        bool enabled = false;
+        int pageSize = 2048;
+        int padding = 2;         // transparent gap so filtering never bleeds a neighbor in
+        int maxEntrySize = 1024; // larger images keep their own texture
+    };
+    
+    // Pack eligible surfaces into atlas pages and create the pages; entries that
+    // were packed have their surface freed and set to nullptr
+    void packAtlas(SDL_Renderer* renderer, std::vector<PendingTexture>& pending, AtlasSettings settings);
+    
+    std::map<std::string, TextureRegion> textures;
+    std::vector<SDL_Texture*> atlasPages;
+    std::map<std::string, SDL_Point> textureSizes;  // Kept even when no texture is created (headless)
     std::map<std::string, Mix_Chunk*> sounds;
     int highScore = 0;
 };
@@ -2,9 +2,9 @@
 #include "GameObject.h"
 #include "TransformComponent.h"
 #include "Engine.h"
+#include "JobSystem.h"
 #include <cmath>
 #include <cstdlib>
-#include <vector>
 
 void AsteroidSpawner::init() {
     transform = owner->getComponent<TransformComponent>();
@@ -57,25 +57,20 @@ void AsteroidSpawner::update(float deltaTime) {
         lastSpawnX = playerX;
     }
 
-    // Cleanup distant asteroids
-    // Create a snapshot of asteroids first to avoid iterator invalidation
-    std::vector<GameObject*> asteroidsToCheck;
-    for (auto& obj : Engine::getInstance().getGameObjects()) {
-        if (obj && obj->hasTag("asteroid")) {
-            asteroidsToCheck.push_back(obj.get());
-        }
-    }
-    
-    // Now check distances and mark for deletion
-    for (GameObject* astPtr : asteroidsToCheck) {
-        auto* astTransform = astPtr->getComponent<TransformComponent>();
-        if (astTransform) {
-            float dx = astTransform->getX() - playerX;
-            float dy = astTransform->getY() - playerY;
-            float dist = std::sqrt(dx * dx + dy * dy);
-            if (dist > cleanupDistance) {
-                astPtr->markForDeletion();
+    // Cleanup distant asteroids. Marking does not change the tag list and each
+    // chunk only touches its own asteroids, so large fields are split across workers.
+    const float cleanupDistanceSq = cleanupDistance * cleanupDistance;
+    const std::vector<GameObject*>& asteroids = Engine::getInstance().getObjectsWithTag(Tags::Asteroid);
+    JobSystem::getInstance().parallelFor(asteroids.size(), 512, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            auto* astTransform = asteroids[i]->getComponent<TransformComponent>();
+            if (astTransform) {
+                float dx = astTransform->getX() - playerX;
+                float dy = astTransform->getY() - playerY;
+                if (dx * dx + dy * dy > cleanupDistanceSq) {
+                    asteroids[i]->markForDeletion();
+                }
             }
         }
-    }
+    });
 }
@@ -10,6 +10,7 @@ public:
 
     void init() override;
     void update(float deltaTime) override;
+    UpdatePhase getUpdatePhase() const override { return UpdatePhase::Gameplay; }
 
     // Configuration
     void setSpawnBuffer(float buffer) { spawnBuffer = buffer; }
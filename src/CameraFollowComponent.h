@@ -9,6 +9,7 @@ public:
     
     void init() override;
     void update(float deltaTime) override;
+    UpdatePhase getUpdatePhase() const override { return UpdatePhase::Camera; }
     
 private:
     TransformComponent* transform = nullptr;
@@ -0,0 +1,65 @@
+#include "CollisionDispatcher.h"
+#include "Engine.h"
+#include "GameObject.h"
+#include "GameObjectHandle.h"
+
+CollisionDispatcher::CollisionDispatcher()
+    : handlers(static_cast<size_t>(CollisionLayers::MaxLayers) * CollisionLayers::MaxLayers) {
+    events.reserve(256);
+}
+
+void CollisionDispatcher::on(CollisionLayerId layerA, CollisionLayerId layerB, Callback callback) {
+    if (layerA >= CollisionLayers::MaxLayers || layerB >= CollisionLayers::MaxLayers) return;
+    handlers[pairIndex(layerA, layerB)].push_back({callback, false});
+    if (layerA != layerB) {
+        handlers[pairIndex(layerB, layerA)].push_back({std::move(callback), true});
+    }
+}
+
+void CollisionDispatcher::clearHandlers() {
+    for (auto& list : handlers) {
+        list.clear();
+    }
+}
+
+CollisionLayerId CollisionDispatcher::layerOf(b2ShapeId shape) {
+    // Shapes carry exactly one category bit (CollisionLayers::getFilter)
+    std::uint64_t bits = b2Shape_GetFilter(shape).categoryBits;
+    if (bits == 0) return CollisionLayers::Invalid;
+    CollisionLayerId layer = 0;
+    while ((bits & 1) == 0) {
+        bits >>= 1;
+        ++layer;
+    }
+    return layer;
+}
+
+void CollisionDispatcher::collect(b2WorldId world, const Engine& engine) {
+    events.clear();  // keeps capacity
+    b2ContactEvents contacts = b2World_GetContactEvents(world);
+    for (int i = 0; i < contacts.beginCount; ++i) {
+        const b2ContactBeginTouchEvent& contact = contacts.beginEvents[i];
+        CollisionLayerId layerA = layerOf(contact.shapeIdA);
+        CollisionLayerId layerB = layerOf(contact.shapeIdB);
+        if (layerA == CollisionLayers::Invalid || layerB == CollisionLayers::Invalid) continue;
+        if (handlers[pairIndex(layerA, layerB)].empty()) continue;
+        
+        GameObject* a = engine.resolve(GameObjectHandle::fromUserData(b2Body_GetUserData(b2Shape_GetBody(contact.shapeIdA))));
+        GameObject* b = engine.resolve(GameObjectHandle::fromUserData(b2Body_GetUserData(b2Shape_GetBody(contact.shapeIdB))));
+        if (!a || !b) continue;
+        events.push_back({a, b, layerA, layerB});
+    }
+}
+
+void CollisionDispatcher::dispatch() {
+    for (const Event& event : events) {
+        for (const Handler& handler : handlers[pairIndex(event.layerA, event.layerB)]) {
+            if (event.a->isMarkedForDeletion() || event.b->isMarkedForDeletion()) break;
+            if (handler.swapped) {
+                handler.callback(event.b, event.a);
+            } else {
+                handler.callback(event.a, event.b);
+            }
+        }
+    }
+}
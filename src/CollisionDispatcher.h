@@ -0,0 +1,52 @@
+#pragma once
+#include "CollisionLayers.h"
+#include <box2d/box2d.h>
+#include <array>
+#include <functional>
+#include <vector>
+
+class GameObject;
+class Engine;
+
+// Routes Box2D contact begin events to gameplay callbacks keyed by the pair of
+// collision layers involved. After each step, collect() resolves the step's
+// events into a reusable buffer and dispatch() calls the handlers for each pair,
+// so handling cost is a table lookup per event regardless of how many
+// interactions are registered.
+class CollisionDispatcher {
+public:
+    // Called with the object on layer A first, whichever shape Box2D listed first
+    using Callback = std::function<void(GameObject* a, GameObject* b)>;
+    
+    CollisionDispatcher();
+    
+    void on(CollisionLayerId layerA, CollisionLayerId layerB, Callback callback);
+    void clearHandlers();
+    
+    // Resolve this step's begin-touch events (objects and layers) into the buffer
+    void collect(b2WorldId world, const Engine& engine);
+    // Run handlers for the collected events. Pairs where either object is
+    // already marked for deletion are skipped, so one object is not handled twice.
+    void dispatch();
+    
+private:
+    struct Event {
+        GameObject* a;
+        GameObject* b;
+        CollisionLayerId layerA;
+        CollisionLayerId layerB;
+    };
+    
+    static CollisionLayerId layerOf(b2ShapeId shape);
+    static size_t pairIndex(CollisionLayerId a, CollisionLayerId b) {
+        return static_cast<size_t>(a) * CollisionLayers::MaxLayers + b;
+    }
+    
+    // Flat (layerA, layerB) table; on(a, b) also registers the swapped pair
+    struct Handler {
+        Callback callback;
+        bool swapped;  // registered as (b, a): pass objects in reverse
+    };
+    std::vector<std::vector<Handler>> handlers;
+    std::vector<Event> events;
+};
@@ -0,0 +1,107 @@
+#include "CollisionLayers.h"
+#include <tinyxml2.h>
+#include <iostream>
+#include <sstream>
+
+std::vector<CollisionLayers::Layer>& CollisionLayers::layers() {
+    // Built-in layers first so their IDs match the constants in CollisionLayers.h.
+    // Defaults match config.xml: only the player asks for contact events.
+    static std::vector<Layer> registered = {
+        {"default", ~std::uint64_t(0), false},
+        {"player", ~std::uint64_t(0), true},
+        {"asteroid", ~std::uint64_t(0), false},
+    };
+    return registered;
+}
+
+bool CollisionLayers::loadFromXML(const std::string& path) {
+    tinyxml2::XMLDocument doc;
+    if (doc.LoadFile(path.c_str()) != tinyxml2::XML_SUCCESS) {
+        std::cerr << "CollisionLayers: could not load XML '" << path << "', using defaults." << std::endl;
+        return false;
+    }
+    auto* root = doc.FirstChildElement("assets");
+    auto* section = root ? root->FirstChildElement("collisionLayers") : nullptr;
+    if (!section) {
+        return false;
+    }
+    
+    // Register every layer first so collidesWith can name layers declared later
+    for (auto* elem = section->FirstChildElement("layer"); elem; elem = elem->NextSiblingElement("layer")) {
+        if (const char* name = elem->Attribute("name")) {
+            intern(name);
+        }
+    }
+    
+    for (auto* elem = section->FirstChildElement("layer"); elem; elem = elem->NextSiblingElement("layer")) {
+        const char* name = elem->Attribute("name");
+        CollisionLayerId id = name ? find(name) : Invalid;
+        if (id == Invalid) continue;
+        Layer& layer = layers()[id];
+        
+        if (const char* collidesWith = elem->Attribute("collidesWith")) {
+            layer.mask = 0;
+            // Space or comma separated layer names
+            std::string list(collidesWith);
+            for (char& c : list) {
+                if (c == ',') c = ' ';
+            }
+            std::istringstream names(list);
+            std::string other;
+            while (names >> other) {
+                CollisionLayerId otherId = find(other);
+                if (otherId == Invalid) {
+                    std::cerr << "CollisionLayers: layer '" << layer.name << "' lists unknown layer '" << other
+                              << "'" << std::endl;
+                    continue;
+                }
+                layer.mask |= toBit(otherId);
+            }
+        }
+        elem->QueryBoolAttribute("contactEvents", &layer.contactEvents);
+    }
+    return true;
+}
+
+CollisionLayerId CollisionLayers::intern(const std::string& name) {
+    CollisionLayerId existing = find(name);
+    if (existing != Invalid) return existing;
+    
+    std::vector<Layer>& all = layers();
+    if (all.size() >= MaxLayers) {
+        std::cerr << "CollisionLayers: cannot register '" << name << "', all " << int(MaxLayers)
+                  << " layers are in use" << std::endl;
+        return Invalid;
+    }
+    all.push_back({name, ~std::uint64_t(0), false});
+    return static_cast<CollisionLayerId>(all.size() - 1);
+}
+
+CollisionLayerId CollisionLayers::find(const std::string& name) {
+    const std::vector<Layer>& all = layers();
+    for (size_t i = 0; i < all.size(); ++i) {
+        if (all[i].name == name) return static_cast<CollisionLayerId>(i);
+    }
+    return Invalid;
+}
+
+const std::string& CollisionLayers::getName(CollisionLayerId id) {
+    static const std::string none;
+    const std::vector<Layer>& all = layers();
+    return id < all.size() ? all[id].name : none;
+}
+
+b2Filter CollisionLayers::getFilter(CollisionLayerId id) {
+    b2Filter filter = b2DefaultFilter();
+    const std::vector<Layer>& all = layers();
+    if (id < all.size()) {
+        filter.categoryBits = toBit(id);
+        filter.maskBits = all[id].mask;
+    }
+    return filter;
+}
+
+bool CollisionLayers::hasContactEvents(CollisionLayerId id) {
+    const std::vector<Layer>& all = layers();
+    return id < all.size() && all[id].contactEvents;
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <box2d/box2d.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Collision layers map onto Box2D's category/mask filter: each layer is one
+// category bit, and its mask lists the layers it may touch. As in Box2D, a
+// pair collides only if each side's mask accepts the other. Contact begin
+// events are enabled per layer; Box2D reports a pair when either shape has
+// them on, so only layers with gameplay callbacks (the player) turn them on.
+//
+// Configured from <collisionLayers> in config.xml:
+//   <layer name="player" collidesWith="asteroid" contactEvents="true"/>
+// A layer without collidesWith collides with every layer.
+using CollisionLayerId = std::uint8_t;
+
+class CollisionLayers {
+public:
+    static constexpr CollisionLayerId MaxLayers = 64;  // b2Filter bits
+    static constexpr CollisionLayerId Invalid = 0xFF;
+    
+    // Layers the engine itself uses (registered in this order at startup)
+    static constexpr CollisionLayerId Default = 0;
+    static constexpr CollisionLayerId Player = 1;
+    static constexpr CollisionLayerId Asteroid = 2;
+    
+    // Reads <collisionLayers>; built-in defaults stay in place if the section is missing
+    static bool loadFromXML(const std::string& path);
+    
+    // Returns the ID for a name, registering it on first use (Invalid once MaxLayers are in use)
+    static CollisionLayerId intern(const std::string& name);
+    static CollisionLayerId find(const std::string& name);
+    static const std::string& getName(CollisionLayerId id);
+    
+    static b2Filter getFilter(CollisionLayerId id);
+    static bool hasContactEvents(CollisionLayerId id);
+    
+    static std::uint64_t toBit(CollisionLayerId id) { return id < MaxLayers ? (std::uint64_t(1) << id) : 0; }
+    
+private:
+    struct Layer {
+        std::string name;
+        std::uint64_t mask = ~std::uint64_t(0);
+        bool contactEvents = false;
+    };
+    static std::vector<Layer>& layers();
+};
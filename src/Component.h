@@ -1,7 +1,41 @@
 #pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 
 class GameObject;
+struct RenderSnapshot;
+
+// Dense per-type component IDs. Each component class gets the next free ID the
+// first time getComponentTypeId<T>() runs; afterwards the lookup is a static load.
+using ComponentTypeId = std::size_t;
+constexpr ComponentTypeId MaxComponentTypes = 32;
+
+inline ComponentTypeId nextComponentTypeId() {
+    static std::atomic<ComponentTypeId> next{0};
+    return next++;
+}
+
+template<typename T>
+ComponentTypeId getComponentTypeId() {
+    static const ComponentTypeId id = nextComponentTypeId();
+    return id;
+}
+
+// When a component's update() runs within a fixed step. The engine walks one
+// list per phase in this order, around the physics step:
+//   Input -> Gameplay -> [physics step + contacts] -> PhysicsSync -> Camera -> Late
+// Components without per-step work stay at None and are never called.
+enum class UpdatePhase : std::uint8_t {
+    Input,        // sample this step's input
+    Gameplay,     // steering, forces, spawning, timers
+    PhysicsSync,  // after the step, once transforms hold the new poses
+    Camera,       // view follows the synced poses
+    Late,         // reads the final state of the step (particle emitters)
+    Count,
+    None = Count
+};
 
 class Component {
 public:
@@ -9,8 +43,12 @@ public:
     
     virtual void init() {}
     virtual void update(float deltaTime) {}
+    virtual UpdatePhase getUpdatePhase() const { return UpdatePhase::None; }
     virtual void render() {}
     
+    // Copy render state into a snapshot (simulation side; drawing happens elsewhere)
+    virtual void snapshot(RenderSnapshot& out) const {}
+    
     void setOwner(GameObject* owner) { this->owner = owner; }
     GameObject* getOwner() const { return owner; }
     
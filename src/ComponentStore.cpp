@@ -0,0 +1,138 @@
+#include "ComponentStore.h"
+#include "TransformComponent.h"
+#include "RenderSnapshot.h"
+#include "Engine.h"
+#include "GameObject.h"
+
+size_t ComponentStore::addRow(TransformComponent* owner) {
+    size_t row = owners.size();
+    x.push_back(0.0f);
+    y.push_back(0.0f);
+    velocityX.push_back(0.0f);
+    velocityY.push_back(0.0f);
+    rotation.push_back(0.0f);
+    prevX.push_back(0.0f);
+    prevY.push_back(0.0f);
+    prevRotation.push_back(0.0f);
+    hasPrevious.push_back(0);
+    
+    hasSprite.push_back(0);
+    texture.push_back(nullptr);
+    textureUV.push_back({0.0f, 0.0f, 1.0f, 1.0f});
+    width.push_back(50.0f);
+    height.push_back(50.0f);
+    color.push_back({255, 255, 255, 255});
+    
+    bodyId.push_back(b2_nullBodyId);
+    bodyType.push_back(BodyType::Dynamic);
+    shapeType.push_back(ShapeType::Circle);
+    
+    owners.push_back(owner);
+    return row;
+}
+
+namespace {
+    template<typename T>
+    void swapRemove(std::vector<T>& column, size_t row) {
+        column[row] = column.back();
+        column.pop_back();
+    }
+}
+
+void ComponentStore::removeRow(size_t row) {
+    swapRemove(x, row);
+    swapRemove(y, row);
+    swapRemove(velocityX, row);
+    swapRemove(velocityY, row);
+    swapRemove(rotation, row);
+    swapRemove(prevX, row);
+    swapRemove(prevY, row);
+    swapRemove(prevRotation, row);
+    swapRemove(hasPrevious, row);
+    swapRemove(hasSprite, row);
+    swapRemove(texture, row);
+    swapRemove(textureUV, row);
+    swapRemove(width, row);
+    swapRemove(height, row);
+    swapRemove(color, row);
+    swapRemove(bodyId, row);
+    swapRemove(bodyType, row);
+    swapRemove(shapeType, row);
+    swapRemove(owners, row);
+    
+    // The last row now lives at 'row'; tell its facade
+    if (row < owners.size()) {
+        owners[row]->row = row;
+    }
+}
+
+void ComponentStore::reserve(size_t rows) {
+    x.reserve(rows); y.reserve(rows);
+    velocityX.reserve(rows); velocityY.reserve(rows);
+    rotation.reserve(rows);
+    prevX.reserve(rows); prevY.reserve(rows); prevRotation.reserve(rows);
+    hasPrevious.reserve(rows);
+    hasSprite.reserve(rows); texture.reserve(rows); textureUV.reserve(rows);
+    width.reserve(rows); height.reserve(rows); color.reserve(rows);
+    bodyId.reserve(rows); bodyType.reserve(rows); shapeType.reserve(rows);
+    owners.reserve(rows);
+}
+
+void ComponentStore::storePrevious() {
+    const size_t count = size();
+    for (size_t i = 0; i < count; ++i) {
+        prevX[i] = x[i];
+        prevY[i] = y[i];
+        prevRotation[i] = rotation[i];
+        hasPrevious[i] = 1;
+    }
+}
+
+void ComponentStore::integrateVelocities(float dt) {
+    const size_t count = size();
+    for (size_t i = 0; i < count; ++i) {
+        if (B2_IS_NON_NULL(bodyId[i])) continue;  // the physics body owns this transform
+        x[i] += velocityX[i] * dt;
+        y[i] += velocityY[i] * dt;
+    }
+}
+
+void ComponentStore::syncFromMoveEvents(b2WorldId world) {
+    // Box2D reports only awake bodies that moved during the last step, so static
+    // asteroids and sleeping bodies cost nothing here
+    const float pixelsPerMeter = PhysicsBodyComponent::PIXELS_PER_METER;
+    const Engine& engine = Engine::getInstance();
+    b2BodyEvents events = b2World_GetBodyEvents(world);
+    for (int i = 0; i < events.moveCount; ++i) {
+        const b2BodyMoveEvent& event = events.moveEvents[i];
+        GameObject* obj = engine.resolve(GameObjectHandle::fromUserData(event.userData));
+        TransformComponent* transform = obj ? obj->getComponent<TransformComponent>() : nullptr;
+        if (!transform) continue;
+        size_t row = transform->getRow();
+        x[row] = event.transform.p.x * pixelsPerMeter;
+        y[row] = event.transform.p.y * pixelsPerMeter;
+        rotation[row] = b2Rot_GetAngle(event.transform.q) * 180.0f / 3.14159f;
+    }
+}
+
+void ComponentStore::snapshotSprites(std::vector<SpriteInstance>& out) const {
+    const size_t count = size();
+    for (size_t i = 0; i < count; ++i) {
+        if (!hasSprite[i]) continue;
+        
+        SpriteInstance instance;
+        instance.texture = texture[i];
+        instance.uv = textureUV[i];
+        instance.x = x[i];
+        instance.y = y[i];
+        instance.rotation = rotation[i];
+        // Newly spawned rows render at their current state
+        instance.prevX = hasPrevious[i] ? prevX[i] : x[i];
+        instance.prevY = hasPrevious[i] ? prevY[i] : y[i];
+        instance.prevRotation = hasPrevious[i] ? prevRotation[i] : rotation[i];
+        instance.width = width[i];
+        instance.height = height[i];
+        instance.color = color[i];
+        out.push_back(instance);
+    }
+}
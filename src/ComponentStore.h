@@ -0,0 +1,65 @@
+#pragma once
+#include "PhysicsBodyComponent.h"
+#include <SDL2/SDL.h>
+#include <box2d/box2d.h>
+#include <cstddef>
+#include <vector>
+
+class TransformComponent;
+struct SpriteInstance;
+
+// Structure-of-arrays storage for the per-entity data that is touched every step:
+// transforms, sprites and physics bodies. Each TransformComponent owns one row;
+// SpriteComponent and PhysicsBodyComponent fill the sprite/physics columns of
+// their owner's row. The components themselves are thin facades over a row so
+// gameplay code keeps using getComponent<T>(), while the systems below walk the
+// columns linearly.
+//
+// Rows are swap-removed, so row indices are not stable: the TransformComponent
+// that owns a row is told when it moves. Bodies find their row through their
+// owner's handle (body user data) rather than by row index. Only the simulation thread touches the store.
+class ComponentStore {
+public:
+    static ComponentStore& getInstance() {
+        static ComponentStore instance;
+        return instance;
+    }
+    
+    ComponentStore(const ComponentStore&) = delete;
+    ComponentStore& operator=(const ComponentStore&) = delete;
+    
+    size_t addRow(TransformComponent* owner);
+    void removeRow(size_t row);
+    size_t size() const { return owners.size(); }
+    void reserve(size_t rows);
+    
+    // Systems (one pass over the columns each)
+    void storePrevious();                // current -> previous, for render interpolation
+    void integrateVelocities(float dt);  // rows without a physics body
+    void syncFromMoveEvents(b2WorldId world);  // bodies that moved this step -> transform columns
+    void snapshotSprites(std::vector<SpriteInstance>& out) const;
+    
+    // Transform columns
+    std::vector<float> x, y;
+    std::vector<float> velocityX, velocityY;
+    std::vector<float> rotation;                // degrees (0 = right)
+    std::vector<float> prevX, prevY, prevRotation;
+    std::vector<Uint8> hasPrevious;             // 0 until the first storePrevious()
+    
+    // Sprite columns (hasSprite = 0: the row has no sprite)
+    std::vector<Uint8> hasSprite;
+    std::vector<SDL_Texture*> texture;          // nullptr = draw a colored rect
+    std::vector<SDL_FRect> textureUV;           // normalized source rect (atlas region)
+    std::vector<float> width, height;
+    std::vector<SDL_Color> color;
+    
+    // Physics columns (b2_nullBodyId until the body is created)
+    std::vector<b2BodyId> bodyId;
+    std::vector<BodyType> bodyType;
+    std::vector<ShapeType> shapeType;
+    
+    std::vector<TransformComponent*> owners;    // row -> facade, for index fix-up on removal
+    
+private:
+    ComponentStore() = default;
+};
@@ -16,25 +16,65 @@
 #include "AsteroidSpawner.h"
 #include <tinyxml2.h>
 #include <iostream>
+#include <algorithm>
 #include <cmath>
+#include <cstdio>
 #include <SDL2/SDL_mixer.h>
 #include "ScoreDisplay.h"
 #include "GameOverScreen.h"
 #include "AssetManager.h"
+#include "FrameProfiler.h"
+#include "SceneRenderer.h"
+#include "InputRecorder.h"
+#include "ComponentStore.h"
+#include "PhysicsTasks.h"
+#include "PhysicsShapeCache.h"
+#include "CollisionDispatcher.h"
+#include "PhysicsProfiler.h"
+#include "PhysicsOverlay.h"
+#include <thread>
 
-int Engine::targetFPS = 60;
+std::atomic<int> Engine::targetFPS{60};
 float Engine::deltaTime = 0.0f;
-int Engine::mouseX = 0;
-int Engine::mouseY = 0;
+InputState Engine::input;
+InputState Engine::previousInput;
 int Engine::logicFPS = 60;
 float Engine::fixedDeltaTime = 1.0f / 60.0f;
+float Engine::timeScale = 1.0f;
 
 Engine& Engine::getInstance() {
     static Engine instance;
     return instance;
 }
 
-bool Engine::init(const std::string& title, int width, int height) {
+bool Engine::init(const std::string& title, int width, int height, bool headless) {
+    this->headless = headless;
+    windowWidth = width;
+    windowHeight = height;
+    registerCollisionHandlers();
+    
+    if (headless) {
+        // Simulation only: no video, audio or fonts. Window size is kept so spawn
+        // distances and view math match a windowed run.
+        if (SDL_Init(SDL_INIT_TIMER | SDL_INIT_EVENTS) < 0) {
+            std::cerr << "SDL could not initialize! SDL_Error: " << SDL_GetError() << std::endl;
+            return false;
+        }
+        
+        AssetManager::getInstance().loadHighScoreFromXML("assets/config.xml");
+        
+        b2WorldDef worldDef = b2DefaultWorldDef();
+        worldDef.gravity = {0.0f, 0.0f};
+        PhysicsTasks::getInstance().configure(worldDef);  // solver runs on the job system
+        physicsWorldId = b2CreateWorld(&worldDef);
+        
+        running = true;
+        lastFrameTime = SDL_GetTicks();
+        
+        std::cout << "Engine initialized in headless mode" << std::endl;
+        return true;
+    }
+    
     if (SDL_Init(SDL_INIT_VIDEO) < 0) {
         std::cerr << "SDL could not initialize! SDL_Error: " << SDL_GetError() << std::endl;
         return false;
@@ -48,9 +88,6 @@ bool Engine::init(const std::string& title, int width, int height) {
         SDL_WINDOW_SHOWN
     );
     
-    windowWidth = width;
-    windowHeight = height;
-    
     if (!window) {
         std::cerr << "Window could not be created! SDL_Error: " << SDL_GetError() << std::endl;
         return false;
@@ -74,19 +111,26 @@ bool Engine::init(const std::string& title, int width, int height) {
         return false;
     }
 
+    sceneRenderer = new SceneRenderer(renderer);
+    
     // Create score display (use a default font path, e.g., assets/arial.ttf)
     scoreDisplay = new ScoreDisplay(renderer, "assets/arial.ttf", 24);
     
     // Create game over screen
     gameOverScreen = new GameOverScreen(renderer, "assets/arial.ttf", 48, width, height);
     
+    // Box2D timings and counters (toggled with F5)
+    physicsOverlay = new PhysicsOverlay(renderer, "assets/arial.ttf", 14, width);
+    
     // Load high score from XML
     AssetManager::getInstance().loadHighScoreFromXML("assets/config.xml");
     gameOverScreen->setHighScore(AssetManager::getInstance().getHighScore());
+    hudHighScore = AssetManager::getInstance().getHighScore();
     
     // Create physics world with zero gravity (space environment)
     b2WorldDef worldDef = b2DefaultWorldDef();
     worldDef.gravity = {0.0f, 0.0f};
+    PhysicsTasks::getInstance().configure(worldDef);  // solver runs on the job system
     physicsWorldId = b2CreateWorld(&worldDef);
     
     running = true;
@@ -98,22 +142,20 @@ bool Engine::init(const std::string& title, int width, int height) {
 
 GameObject* Engine::spawnBackground(const std::string& texture, float tileW, float tileH, float scrollX, float scrollY) {
     auto gameObj = std::make_unique<GameObject>();
-    gameObj->setTag("background");
+    gameObj->setTag(Tags::Background);
     
     auto* background = gameObj->addComponent<BackgroundComponent>();
     background->setTexture(texture);
     background->setTileSize(tileW, tileH);
     background->setScrollSpeed(scrollX, scrollY);
     
-    GameObject* ptr = gameObj.get();
-    gameObjects.push_back(std::move(gameObj));
-    return ptr;
+    return addGameObject(std::move(gameObj));
 }
 
 GameObject* Engine::spawnPlayer(float x, float y, const std::string& texture, float spriteWidth,
                                 float thrustForce, float maxSpeed) {
     auto gameObj = std::make_unique<GameObject>();
-    gameObj->setTag("player");
+    gameObj->setTag(Tags::Player);
     
     // Transform
     auto* transform = gameObj->addComponent<TransformComponent>();
@@ -132,10 +174,10 @@ GameObject* Engine::spawnPlayer(float x, float y, const std::string& texture, fl
     physics->setAngularDamping(0.0f);
     physics->setFixedRotation(false);
     physics->setDensity(1.0f);
+    physics->setCollisionLayer(CollisionLayers::Player);
     
     // Input & Control
-    auto* input = gameObj->addComponent<InputComponent>();
-    gameOverInput = input;  // Store reference for restart input
+    gameObj->addComponent<InputComponent>();
     
     // Rotation behavior (hardcoded defaults - can be parameterized later if needed)
     auto* rotateToMouse = gameObj->addComponent<RotateToMouseComponent>();
@@ -177,8 +219,7 @@ GameObject* Engine::spawnPlayer(float x, float y, const std::string& texture, fl
     spawner->setCleanupDistance(1500.0f); // despawn 1500px from player
     spawner->setSpawnDensity(0.25f);      // 0.25 asteroids per direction (1 per 4 spawn triggers)
     
-    GameObject* ptr = gameObj.get();
-    gameObjects.push_back(std::move(gameObj));
+    GameObject* ptr = addGameObject(std::move(gameObj));
     
     // Store player reference and spawn position for score tracking
     player = ptr;
@@ -191,11 +232,12 @@ GameObject* Engine::spawnPlayer(float x, float y, const std::string& texture, fl
     return ptr;
 }
 
-GameObject* Engine::spawnAsteroid(float x, float y, float size) {
+GameObjectHandle Engine::spawnAsteroid(float x, float y, float size) {
     // Queue the asteroid for spawning after the update loop completes
     // This prevents vector reallocation crashes during component updates
-    pendingAsteroids.push_back({x, y, size});
-    return nullptr;  // Placeholder - actual object will exist after processPendingAsteroids()
+    GameObjectHandle handle = reserveHandle();
+    pendingAsteroids.push_back({x, y, size, handle});
+    return handle;  // resolves after processPendingAsteroids()
 }
 
 void Engine::loadGameObjectsFromXML(const std::string& filepath) {
@@ -220,10 +262,11 @@ void Engine::loadGameObjectsFromXML(const std::string& filepath) {
         
         std::string typeStr(type);
         
-        // Spawn background
+        // Spawn background layers, back to front
         if (typeStr == "background") {
-            tinyxml2::XMLElement* bgElement = objElement->FirstChildElement("background");
-            if (bgElement) {
+            for (tinyxml2::XMLElement* bgElement = objElement->FirstChildElement("background");
+                 bgElement != nullptr;
+                 bgElement = bgElement->NextSiblingElement("background")) {
                 const char* texture = bgElement->Attribute("texture");
                 float tileWidth = bgElement->FloatAttribute("tileWidth", 800.0f);
                 float tileHeight = bgElement->FloatAttribute("tileHeight", 600.0f);
@@ -261,16 +304,9 @@ void Engine::loadGameObjectsFromXML(const std::string& filepath) {
             
             GameObject* player = spawnPlayer(x, y, texture ? texture : "rocket", spriteWidth, thrustForce, maxSpeed);
             
-            // Find player by tag (safer than holding pointer across potential reallocations)
-            GameObject* playerPtr = nullptr;
-            for (auto& obj : gameObjects) {
-                if (obj && obj->hasTag("player")) {
-                    playerPtr = obj.get();
-                    break;
-                }
-            }
-            
-            if (!playerPtr) continue;
+            const std::vector<GameObject*>& players = getObjectsWithTag(Tags::Player);
+            if (players.empty()) continue;
+            GameObject* playerPtr = players.front();
             
             // Parse particle emitter (if present)
             tinyxml2::XMLElement* particleElem = objElement->FirstChildElement("particleEmitter");
@@ -400,40 +436,235 @@ void Engine::loadGameObjectsFromXML(const std::string& filepath) {
 }
 
 void Engine::run() {
-    const int frameDelay = 1000 / targetFPS; // render cap
-    Uint32 previousTicks = SDL_GetTicks();
-    float accumulator = 0.0f;
+    tickCount = 0;
+    if (headless) {
+        runHeadless();
+        return;
+    }
+    
+    // Give the first frame something to draw before any step has run
+    publishSnapshot();
+    
+    if (useSimulationThread) {
+        runThreaded();
+        return;
+    }
+    
+    double accumulator = 0.0;
+    framePacer.beginFrame();
     
     while (running) {
-        Uint32 currentTicks = SDL_GetTicks();
-        float frameTime = (currentTicks - previousTicks) / 1000.0f; // seconds
-        previousTicks = currentTicks;
+        double frameTime = framePacer.beginFrame(); // seconds, performance-counter resolution
+        if (timeScale > 0.0f) frameTime *= timeScale;
+        accumulator += frameTime;
         
-        // Clamp very large frame time to avoid spiral of death
-        if (frameTime > 0.25f) frameTime = 0.25f;
+        {
+            ProfileScope frameScope(ProfilePhase::Frame);
+            
+            handleEvents();
+            
+            // Fixed timestep updates
+            bool stepped = runFixedSteps(accumulator) > 0;
+            if (maxTicks > 0 && tickCount >= maxTicks) {
+                running = false;
+            }
+            if (stepped) {
+                publishSnapshot();
+            }
+            
+            // Leftover time is rendered by blending the last two steps instead of being dropped
+            render(snapshots.acquireLatest(), static_cast<float>(accumulator / fixedDeltaTime));
+        }
+        
+        // Frame limiting for rendering only
+        framePacer.waitForNextFrame();
+    }
+    
+    printTimeDilationSummary();
+}
+
+namespace {
+    // Wakes per second for a loop stepping at logicFPS scaled by timeScale. At least 1:
+    // a slow-motion rate that rounds to 0 would read as uncapped and spin a core.
+    int scaledStepRate(int logicFPS, float timeScale) {
+        long rate = std::lround(logicFPS * (timeScale > 0.0f ? timeScale : 1.0f));
+        return static_cast<int>(std::max(1L, rate));
+    }
+}
+
+void Engine::runThreaded() {
+    std::cout << "Simulation running on its own thread" << std::endl;
+    std::thread simulationThread(&Engine::simulationLoop, this);
+    
+    const double countsPerStep = static_cast<double>(SDL_GetPerformanceFrequency()) * fixedDeltaTime;
+    framePacer.beginFrame();
+    
+    while (running) {
+        framePacer.beginFrame();
+        {
+            ProfileScope frameScope(ProfilePhase::Frame);
+            
+            // SDL events and all SDL rendering stay on the main thread
+            handleEvents();
+            
+            // Blend by how far we are past the moment the newest step was published
+            const RenderSnapshot& snapshot = snapshots.acquireLatest();
+            double alpha = (SDL_GetPerformanceCounter() - snapshot.publishCounter) / countsPerStep;
+            if (alpha > 1.0) alpha = 1.0;
+            render(snapshot, static_cast<float>(alpha));
+        }
+        
+        framePacer.waitForNextFrame();
+    }
+    
+    simulationThread.join();
+    printTimeDilationSummary();
+}
+
+void Engine::simulationLoop() {
+    // Wakes once per (time-scaled) fixed step; a late wake simply runs more than one step
+    FramePacer stepPacer(scaledStepRate(logicFPS, timeScale));
+    double accumulator = 0.0;
+    
+    while (running) {
+        double frameTime = stepPacer.beginFrame();
+        if (timeScale > 0.0f) frameTime *= timeScale;
         accumulator += frameTime;
         
-        handleEvents();
+        if (runFixedSteps(accumulator) > 0) {
+            publishSnapshot();
+        }
+        if (maxTicks > 0 && tickCount >= maxTicks) {
+            running = false;
+        }
         
-        // Fixed timestep updates
-        while (accumulator >= fixedDeltaTime) {
-            deltaTime = fixedDeltaTime; // expose for components querying getDeltaTime()
+        stepPacer.waitForNextFrame();
+    }
+}
+
+void Engine::runHeadless() {
+    const Uint64 frequency = SDL_GetPerformanceFrequency();
+    const Uint64 startCounter = SDL_GetPerformanceCounter();
+    FramePacer stepPacer(scaledStepRate(logicFPS, timeScale));  // one step per wake (unused when unthrottled)
+    double accumulator = 0.0;
+    
+    std::cout << "Headless simulation: logicFPS=" << logicFPS
+              << ", timeScale=" << (timeScale > 0.0f ? std::to_string(timeScale) : std::string("unthrottled"))
+              << ", maxTicks=" << maxTicks << std::endl;
+    
+    while (running) {
+        handleEvents();  // Still honours SDL_QUIT (e.g. Ctrl+C)
+        
+        if (timeScale <= 0.0f) {
+            // Unthrottled: one fixed step per iteration, as fast as the CPU allows
+            deltaTime = fixedDeltaTime;
             update();
-            accumulator -= fixedDeltaTime;
+            ++tickCount;
+        } else {
+            accumulator += stepPacer.beginFrame() * timeScale;
+            runFixedSteps(accumulator);
+            stepPacer.waitForNextFrame();
         }
         
-        render();
-        
-        // Frame limiting for rendering only
-        Uint32 afterRenderTicks = SDL_GetTicks();
-        Uint32 loopFrameTimeMs = afterRenderTicks - currentTicks;
-        if (frameDelay > loopFrameTimeMs) {
-            SDL_Delay(frameDelay - loopFrameTimeMs);
+        // Nobody can press space without a window; keep soak tests going. A replay
+        // restarts on its recorded Space press instead, like the run that made it.
+        if (gameOver && InputRecorder::getInstance().getMode() != InputRecorder::Mode::Replay) {
+            restartGame();
+        }
+        if (maxTicks > 0 && tickCount >= maxTicks) {
+            running = false;
         }
     }
+    
+    double elapsed = static_cast<double>(SDL_GetPerformanceCounter() - startCounter) / frequency;
+    double simulated = tickCount * static_cast<double>(fixedDeltaTime);
+    std::cout << "Headless run: " << tickCount << " ticks in " << elapsed << " s ("
+              << (elapsed > 0.0 ? tickCount / elapsed : 0.0) << " ticks/s, "
+              << (elapsed > 0.0 ? simulated / elapsed : 0.0) << "x real time)" << std::endl;
+    printTimeDilationSummary();
+}
+
+int Engine::runFixedSteps(double& accumulator) {
+    // Never run past --ticks, so the limit holds exactly however many steps are due
+    int stepLimit = maxStepsPerFrame;
+    if (maxTicks > 0) {
+        Uint64 remaining = tickCount < maxTicks ? maxTicks - tickCount : 0;
+        if (remaining < static_cast<Uint64>(stepLimit)) {
+            stepLimit = static_cast<int>(remaining);
+        }
+    }
+    
+    int steps = 0;
+    while (accumulator >= fixedDeltaTime && steps < stepLimit) {
+        deltaTime = fixedDeltaTime; // expose for components querying getDeltaTime()
+        update();
+        ++tickCount;
+        accumulator -= fixedDeltaTime;
+        ++steps;
+    }
+    
+    // Catching up on an overloaded frame only makes the next one slower. Drop whole
+    // steps beyond the cap so the game slows down briefly instead of freezing, and
+    // keep the fraction so interpolation stays smooth. Stopping at the tick limit is
+    // not falling behind.
+    bool reachedMaxTicks = maxTicks > 0 && tickCount >= maxTicks;
+    if (!reachedMaxTicks && accumulator >= fixedDeltaTime) {
+        double excess = std::floor(accumulator / fixedDeltaTime) * fixedDeltaTime;
+        accumulator -= excess;
+        droppedSimulationTime += excess;
+        ++cappedFrames;
+    }
+    return steps;
+}
+
+namespace {
+    template<typename T, typename Row>
+    void copyPool(Row& row, const char* name) {
+        const auto& pool = ObjectPool<T>::getInstance();
+        row.name = name;
+        row.live = pool.getLiveCount();
+        row.capacity = pool.getCapacity();
+        row.hits = pool.getHits();
+        row.misses = pool.getMisses();
+    }
+}
+
+void Engine::capturePoolStats() {
+    // Simulation thread only, where the pools are modified
+    std::lock_guard<std::mutex> lock(poolStatsMutex);
+    copyPool<GameObject>(poolStats[0], "GameObject");
+    copyPool<TransformComponent>(poolStats[1], "TransformComponent");
+    copyPool<SpriteComponent>(poolStats[2], "SpriteComponent");
+    copyPool<PhysicsBodyComponent>(poolStats[3], "PhysicsBodyComponent");
+    copyPool<ParticleEmitterComponent>(poolStats[4], "ParticleEmitterComponent");
+    copyPool<LifetimeComponent>(poolStats[5], "LifetimeComponent");
+    
+    const PhysicsShapeCache& shapes = PhysicsShapeCache::getInstance();
+    shapeCacheSize = shapes.size();
+    shapeCacheHits = shapes.getHits();
+    shapeCacheMisses = shapes.getMisses();
+}
+
+void Engine::printPoolStats() const {
+    std::lock_guard<std::mutex> lock(poolStatsMutex);
+    std::printf("%-26s %8s %8s %12s %12s %8s\n", "pool", "live", "capacity", "hits", "misses", "reuse");
+    for (const PoolStatsRow& row : poolStats) {
+        unsigned long long total = row.hits + row.misses;
+        std::printf("%-26s %8zu %8zu %12llu %12llu %7.1f%%\n", row.name, row.live, row.capacity,
+                    row.hits, row.misses, total > 0 ? 100.0 * row.hits / total : 0.0);
+    }
+    
+    std::printf("shape cache: %zu shapes, %zu hits, %zu misses\n", shapeCacheSize, shapeCacheHits, shapeCacheMisses);
+}
+
+void Engine::printTimeDilationSummary() const {
+    if (cappedFrames == 0) return;
+    std::cout << "Simulation fell behind on " << cappedFrames << " frame(s) (max " << maxStepsPerFrame
+              << " steps per frame); dropped " << droppedSimulationTime << " s of simulated time" << std::endl;
 }
 
 void Engine::handleEvents() {
+    ProfileScope scope(ProfilePhase::Events);
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
         if (event.type == SDL_QUIT) {
@@ -447,116 +678,126 @@ void Engine::handleEvents() {
                 case SDLK_F1:
                     PhysicsDebugDraw::toggle();
                     break;
+                case SDLK_F4: {
+                    // Cycle the render cap to compare pacing at different rates
+                    static const int caps[] = {60, 120, 144, 240, 0};
+                    const int capCount = static_cast<int>(sizeof(caps) / sizeof(caps[0]));
+                    int next = 0;
+                    for (int i = 0; i < capCount; ++i) {
+                        if (caps[i] == targetFPS) next = (i + 1) % capCount;
+                    }
+                    setTargetFPS(caps[next]);
+                    std::cout << "Render cap: " << (caps[next] > 0 ? std::to_string(caps[next]) : std::string("uncapped")) << std::endl;
+                    break;
+                }
+                case SDLK_F3:
+                    if (FrameProfiler::isEnabled()) {
+                        FrameProfiler::getInstance().printSummary(targetFPS > 0 ? 1000.0 / targetFPS : 0.0, 1000.0 * fixedDeltaTime);
+                        PhysicsProfiler::getInstance().printSummary();
+                        printPoolStats();
+                        if (sceneRenderer) {
+                            const SpriteBatch::Stats& sprites = sceneRenderer->getSpriteStats();
+                            std::printf("sprite batch (last frame): %d draw calls, %d vertices, %d quads\n",
+                                        sprites.drawCalls, sprites.vertices, sprites.quads);
+                        }
+                        std::printf("view culling (last frame): sprites %d drawn / %d culled, particles %d / %d, debug bodies %d / %d\n",
+                                    cullStats.sprites.drawn, cullStats.sprites.culled,
+                                    cullStats.particles.drawn, cullStats.particles.culled,
+                                    cullStats.debugBodies.drawn, cullStats.debugBodies.culled);
+                    }
+                    break;
+                case SDLK_F5:
+                    PhysicsProfiler::toggleOverlay();
+                    break;
             }
         }
-        if (event.type == SDL_MOUSEMOTION) {
-            mouseX = event.motion.x;
-            mouseY = event.motion.y;
-        }
     }
+    
+    // Latest device state for the next fixed step (the simulation thread never touches SDL input)
+    InputState sampled = InputState::sample();
+    std::lock_guard<std::mutex> lock(liveInputMutex);
+    liveInput = sampled;
 }
 
 void Engine::update() {
+    ProfileScope updateScope(ProfilePhase::Update);
+    
+    // Pool counters as of the end of the previous step, for F3 on the main thread
+    if (FrameProfiler::isEnabled()) {
+        capturePoolStats();
+    }
+    
+    // Every step consumes exactly one InputState so recordings replay tick for tick
+    if (InputRecorder::getInstance().isReplayFinished()) {
+        running = false;
+        return;
+    }
+    InputState live;
+    {
+        std::lock_guard<std::mutex> lock(liveInputMutex);
+        live = liveInput;
+    }
+    previousInput = input;
+    input = InputRecorder::getInstance().nextTick(live);
+    
     // Handle restart on spacebar press when game is over
-    if (gameOver && gameOverInput && gameOverInput->isSpacePressed()) {
+    bool spacePressed = input.isKeyDown(InputKey::Space) && !previousInput.isKeyDown(InputKey::Space);
+    if (gameOver && spacePressed) {
         restartGame();
         return;  // Skip normal update after restart
     }
     
-    // Refresh mouse position each fixed update to avoid relying solely on motion events
+    // Snapshot last step's state so render() can interpolate toward this step
+    ComponentStore::getInstance().storePrevious();
+    View::getInstance().storePrevious();
+    ParticleSystem::getInstance().storePrevious();
+    
+    // Input and gameplay read last step's poses; forces they apply go into this step
     {
-        int mx = 0, my = 0;
-        SDL_GetMouseState(&mx, &my);
-        mouseX = mx;
-        mouseY = my;
+        ProfileScope objectScope(ProfilePhase::ObjectUpdate);
+        runUpdatePhase(UpdatePhase::Input);
+        runUpdatePhase(UpdatePhase::Gameplay);
     }
+    
     if (b2World_IsValid(physicsWorldId)) {
-        b2World_Step(physicsWorldId, fixedDeltaTime, 4);
-
-        // Read contact events to detect rocket hitting asteroids (static bodies)
-        b2ContactEvents events = b2World_GetContactEvents(physicsWorldId);
-        for (int i = 0; i < events.beginCount; ++i) {
-            const b2ContactBeginTouchEvent& e = events.beginEvents[i];
-            b2BodyId bodyA = b2Shape_GetBody(e.shapeIdA);
-            b2BodyId bodyB = b2Shape_GetBody(e.shapeIdB);
-            auto* objA = static_cast<GameObject*>(b2Body_GetUserData(bodyA));
-            auto* objB = static_cast<GameObject*>(b2Body_GetUserData(bodyB));
-
-            bool aIsPlayer = objA && objA->hasTag("player");
-            bool bIsPlayer = objB && objB->hasTag("player");
-            bool aIsAsteroid = objA && objA->hasTag("asteroid");
-            bool bIsAsteroid = objB && objB->hasTag("asteroid");
-
-            if ((aIsPlayer && bIsAsteroid) || (bIsPlayer && aIsAsteroid)) {
-                std::cout << "Rocket hit asteroid" << std::endl;
-
-                // Stop all looping sounds (especially rocket thrust)
-                AssetManager::getInstance().stopAllSounds();
-
-                // Play explosion sound
-                AssetManager::getInstance().playSound("explosion");
-
-                // Freeze and remove the player
-                GameObject* playerObj = aIsPlayer ? objA : objB;
-                if (playerObj) {
-                    // Mark for deletion to remove from game
-                    playerObj->markForDeletion();
-                    player = nullptr;  // Clear player reference
-                    
-                    // Trigger game over
-                    gameOver = true;
-                    gameOverScreen->setScore(score);
-                    
-                    // Update high score if current score is higher
-                    if (score > AssetManager::getInstance().getHighScore()) {
-                        AssetManager::getInstance().setHighScore(score);
-                        gameOverScreen->setHighScore(score);
-                        AssetManager::getInstance().saveHighScoreToXML("assets/config.xml");
-                    }
-                }
+        // Objects added outside the spawn queue (load, restart, gameplay) join before the step
+        commitPendingBodies();
+        {
+            ProfileScope stepScope(ProfilePhase::PhysicsStep);
+            b2World_Step(physicsWorldId, fixedDeltaTime, 4);
+            PhysicsTasks::getInstance().endStep();
+        }
+        PhysicsProfiler::getInstance().sample(physicsWorldId);
 
-                // Spawn a dedicated explosion emitter GameObject so the player's trail stays intact
-                GameObject* hitObj = aIsAsteroid ? objA : objB;
-                TransformComponent* hitTransform = hitObj ? hitObj->getComponent<TransformComponent>() : nullptr;
-                float x = hitTransform ? hitTransform->getX() : 0.0f;
-                float y = hitTransform ? hitTransform->getY() : 0.0f;
-
-                auto explosion = std::make_unique<GameObject>();
-                explosion->setTag("explosion");
-                auto* t = explosion->addComponent<TransformComponent>();
-                t->setPosition(x, y);
-
-                auto* emitter = explosion->addComponent<ParticleEmitterComponent>();
-                emitter->setEmitterType(EmitterType::Burst);
-                emitter->setBurstCount(explosionConfig.burstCount);
-                emitter->setBurstDuration(explosionConfig.burstDuration);
-                emitter->setLifetime(explosionConfig.lifetime);
-                emitter->setSize(explosionConfig.size);
-                emitter->setSpeedMin(explosionConfig.speedMin);
-                emitter->setSpeedMax(explosionConfig.speedMax);
-                emitter->setSpreadAngle(explosionConfig.spreadAngle);
-                emitter->setDirectionOffset(explosionConfig.directionOffset);
-                emitter->setPositionOffset(explosionConfig.offsetX, explosionConfig.offsetY);
-                emitter->setStartColor(explosionConfig.startColor);
-                emitter->setEndColor(explosionConfig.endColor);
-                emitter->triggerBurst();
-
-                auto* lifetime = explosion->addComponent<LifetimeComponent>();
-                lifetime->setLifetime(explosionConfig.lifetime + 0.3f);
-
-                gameObjects.push_back(std::move(explosion));
-            }
+        // Contact begin events -> per layer-pair handlers (registerCollisionHandlers)
+        ProfileScope contactScope(ProfilePhase::Contacts);
+        collisions.collect(physicsWorldId, *this);
+        collisions.dispatch();
+    }
+    
+    // Transform systems (physics poses, plain velocities), then components that follow the step
+    {
+        ProfileScope syncScope(ProfilePhase::PhysicsSync);
+        if (b2World_IsValid(physicsWorldId)) {
+            ComponentStore::getInstance().syncFromMoveEvents(physicsWorldId);
         }
+        ComponentStore::getInstance().integrateVelocities(fixedDeltaTime);
+        runUpdatePhase(UpdatePhase::PhysicsSync);
     }
     
-    // Use fixedDeltaTime to ensure movement independent of render FPS
-    for (auto& obj : gameObjects) {
-        obj->update(fixedDeltaTime);
+    // Camera follows the synced poses; late components (emitters) see the final state
+    {
+        ProfileScope lateScope(ProfilePhase::LateUpdate);
+        runUpdatePhase(UpdatePhase::Camera);
+        runUpdatePhase(UpdatePhase::Late);
     }
     
     // Update particle system
-    ParticleSystem::getInstance().update(fixedDeltaTime);
-    ParticleSystem::getInstance().update(fixedDeltaTime);
+    {
+        ProfileScope particleScope(ProfilePhase::Particles);
+        ParticleSystem::getInstance().update(fixedDeltaTime);
+        ParticleSystem::getInstance().update(fixedDeltaTime);
+    }
     
     // Update score based on player distance from spawn
     if (player) {
@@ -570,44 +811,182 @@ void Engine::update() {
     }
     
     // Clean up any objects marked for deletion
-    cleanupMarkedObjects();
+    {
+        ProfileScope cleanupScope(ProfilePhase::Cleanup);
+        cleanupMarkedObjects();
+    }
     
     // Process any queued asteroid spawns (happens after update to avoid vector reallocation issues)
-    processPendingAsteroids();
+    {
+        ProfileScope spawnScope(ProfilePhase::SpawnQueue);
+        processPendingAsteroids();
+        commitPendingBodies();
+    }
+}
+
+void Engine::registerCollisionHandlers() {
+    collisions.clearHandlers();
+    collisions.on(CollisionLayers::Player, CollisionLayers::Asteroid,
+                  [this](GameObject* playerHit, GameObject* asteroid) { onPlayerHitAsteroid(playerHit, asteroid); });
+}
+
+void Engine::onPlayerHitAsteroid(GameObject* playerHit, GameObject* asteroid) {
+    std::cout << "Rocket hit asteroid" << std::endl;
+
+    // Stop all looping sounds (especially rocket thrust)
+    AssetManager::getInstance().stopAllSounds();
+
+    // Play explosion sound
+    AssetManager::getInstance().playSound("explosion");
+
+    // Freeze and remove the player
+    playerHit->markForDeletion();
+    player = nullptr;  // Clear player reference
+    
+    // Trigger game over
+    gameOver = true;
+    
+    // Update high score if current score is higher
+    if (score > AssetManager::getInstance().getHighScore()) {
+        AssetManager::getInstance().setHighScore(score);
+        AssetManager::getInstance().saveHighScoreToXML("assets/config.xml");
+    }
+
+    // Spawn a dedicated explosion emitter GameObject so the player's trail stays intact
+    TransformComponent* hitTransform = asteroid->getComponent<TransformComponent>();
+    float x = hitTransform ? hitTransform->getX() : 0.0f;
+    float y = hitTransform ? hitTransform->getY() : 0.0f;
+
+    auto explosion = std::make_unique<GameObject>();
+    explosion->setTag(Tags::Explosion);
+    auto* t = explosion->addComponent<TransformComponent>();
+    t->setPosition(x, y);
+
+    auto* emitter = explosion->addComponent<ParticleEmitterComponent>();
+    emitter->setEmitterType(EmitterType::Burst);
+    emitter->setBurstCount(explosionConfig.burstCount);
+    emitter->setBurstDuration(explosionConfig.burstDuration);
+    emitter->setLifetime(explosionConfig.lifetime);
+    emitter->setSize(explosionConfig.size);
+    emitter->setSpeedMin(explosionConfig.speedMin);
+    emitter->setSpeedMax(explosionConfig.speedMax);
+    emitter->setSpreadAngle(explosionConfig.spreadAngle);
+    emitter->setDirectionOffset(explosionConfig.directionOffset);
+    emitter->setPositionOffset(explosionConfig.offsetX, explosionConfig.offsetY);
+    emitter->setStartColor(explosionConfig.startColor);
+    emitter->setEndColor(explosionConfig.endColor);
+    emitter->triggerBurst();
+
+    auto* lifetime = explosion->addComponent<LifetimeComponent>();
+    lifetime->setLifetime(explosionConfig.lifetime + 0.3f);
+
+    addGameObject(std::move(explosion));
 }
 
-void Engine::render() {
+void Engine::buildSnapshot(RenderSnapshot& out) {
+    out.clear();
+    
+    View::getInstance().getPreviousCenter(out.prevViewX, out.prevViewY);
+    View::getInstance().getCenter(out.viewX, out.viewY);
+    out.viewScale = View::getInstance().getScale();
+    
+    for (auto& obj : gameObjects) {
+        obj->snapshot(out);
+    }
+    ComponentStore::getInstance().snapshotSprites(out.sprites);
+    ParticleSystem::getInstance().snapshot(out.particles);
+    PhysicsDebugDraw::snapshot(out.debugBodies);
+    if (PhysicsProfiler::isOverlayVisible()) {
+        PhysicsProfiler::getInstance().formatOverlay(out.physicsOverlay);
+    }
+    
+    out.score = score;
+    out.highScore = AssetManager::getInstance().getHighScore();
+    out.gameOver = gameOver;
+    out.tick = tickCount;
+}
+
+void Engine::publishSnapshot() {
+    buildSnapshot(snapshots.beginWrite());
+    snapshots.publish();
+}
+
+void Engine::updateHud(const RenderSnapshot& snapshot) {
+    if (scoreDisplay && snapshot.score != hudScore) {
+        scoreDisplay->setScore(snapshot.score);
+        hudScore = snapshot.score;
+    }
+    if (gameOverScreen && snapshot.highScore != hudHighScore) {
+        gameOverScreen->setHighScore(snapshot.highScore);
+        hudHighScore = snapshot.highScore;
+    }
+    if (gameOverScreen && snapshot.gameOver && snapshot.score != hudGameOverScore) {
+        gameOverScreen->setScore(snapshot.score);
+        hudGameOverScore = snapshot.score;
+    }
+}
+
+void Engine::render(const RenderSnapshot& snapshot, float alpha) {
+    ProfileScope renderScope(ProfilePhase::Render);
+    
+    RenderView view = snapshot.makeView(alpha, windowWidth, windowHeight);
+    cullStats = RenderCullStats{};
+    
     // Clear screen with dark blue
     SDL_SetRenderDrawColor(renderer, 20, 20, 40, 255);
     SDL_RenderClear(renderer);
     
-    // Render all game objects
-    for (auto& obj : gameObjects) {
-        obj->render();
+    // Render background layers, then sprites
+    {
+        ProfileScope objectScope(ProfilePhase::RenderObjects);
+        sceneRenderer->renderBackgrounds(snapshot, view, windowWidth, windowHeight);
+        sceneRenderer->renderSprites(snapshot, view, alpha, cullStats.sprites);
     }
 
     // Render particles (after sprites, before debug overlay)
-    ParticleSystem::getInstance().render(renderer, &View::getInstance());
+    {
+        ProfileScope particleScope(ProfilePhase::RenderParticles);
+        sceneRenderer->renderParticles(snapshot, view, alpha, cullStats.particles);
+    }
 
     // Physics debug overlay (draw after normal rendering, before present)
-    PhysicsDebugDraw::render(renderer, gameObjects);
+    {
+        ProfileScope debugScope(ProfilePhase::RenderDebug);
+        PhysicsDebugDraw::render(renderer, snapshot.debugBodies, view, alpha, cullStats.debugBodies);
+        if (physicsOverlay) physicsOverlay->render(snapshot.physicsOverlay);
+    }
 
-    // Render score in top left
-    if (scoreDisplay && !gameOver) scoreDisplay->render();
-    
-    // Render game over screen if game is over
-    if (gameOver && gameOverScreen) gameOverScreen->render();
+    // Render score in top left, or the game over screen
+    {
+        ProfileScope hudScope(ProfilePhase::RenderHud);
+        updateHud(snapshot);
+        if (scoreDisplay && !snapshot.gameOver) scoreDisplay->render();
+        if (snapshot.gameOver && gameOverScreen) gameOverScreen->render();
+    }
 
+    ProfileScope presentScope(ProfilePhase::Present);
     SDL_RenderPresent(renderer);
 }
 
+void Engine::setSoftParticles(bool enabled) {
+    if (sceneRenderer) sceneRenderer->setSoftParticles(enabled);
+}
+
 void Engine::quit() {
     running = false;
 }
 
 void Engine::clean() {
+    // Destroy objects while the physics world, component store and pools still exist
+    clearGameObjects();
+    
     // Clear particle system
     ParticleSystem::getInstance().clear();
+    
+    if (sceneRenderer) {
+        delete sceneRenderer;
+        sceneRenderer = nullptr;
+    }
 
     // Clean up score display
     if (scoreDisplay) {
@@ -615,6 +994,11 @@ void Engine::clean() {
         scoreDisplay = nullptr;
     }
     
+    if (physicsOverlay) {
+        delete physicsOverlay;
+        physicsOverlay = nullptr;
+    }
+    
     // Clean up game over screen
     if (gameOverScreen) {
         delete gameOverScreen;
@@ -640,8 +1024,8 @@ void Engine::clean() {
 }
 
 void Engine::setScore(int newScore) {
+    // The score display picks this up from the next render snapshot
     score = newScore;
-    if (scoreDisplay) scoreDisplay->setScore(score);
     updateAsteroidDifficulty();
 }
 
@@ -649,11 +1033,9 @@ void Engine::restartGame() {
     // Clear game over state
     gameOver = false;
     score = 0;
-    gameOverInput = nullptr;
     
     // Remove all game objects
-    gameObjects.clear();
-    pendingAsteroids.clear();
+    clearGameObjects();
     
     // Clear physics world
     if (b2World_IsValid(physicsWorldId)) {
@@ -663,18 +1045,11 @@ void Engine::restartGame() {
     // Recreate physics world
     b2WorldDef worldDef = b2DefaultWorldDef();
     worldDef.gravity = {0.0f, 0.0f};
+    PhysicsTasks::getInstance().configure(worldDef);  // solver runs on the job system
     physicsWorldId = b2CreateWorld(&worldDef);
     
-    // Reload game objects from XML
+    // Reload game objects from XML (HUD resets from the next render snapshot)
     loadGameObjectsFromXML("assets/config.xml");
-    
-    // Reset score display
-    if (scoreDisplay) {
-        scoreDisplay->setScore(0);
-    }
-    if (gameOverScreen) {
-        gameOverScreen->setScore(0);
-    }
 }
 
 void Engine::updateAsteroidDifficulty() {
@@ -695,6 +1070,7 @@ void Engine::updateAsteroidDifficulty() {
 
 void Engine::setTargetFPS(int fps) {
     targetFPS = fps;
+    getInstance().framePacer.setTargetFPS(fps);
 }
 
 void Engine::setLogicFPS(int fps) {
@@ -703,30 +1079,171 @@ void Engine::setLogicFPS(int fps) {
     fixedDeltaTime = 1.0f / static_cast<float>(logicFPS);
 }
 
+GameObject* Engine::addGameObject(std::unique_ptr<GameObject> obj) {
+    return addGameObject(std::move(obj), reserveHandle());
+}
+
+GameObject* Engine::addGameObject(std::unique_ptr<GameObject> obj, GameObjectHandle handle) {
+    GameObject* ptr = obj.get();
+    ptr->handle = handle;
+    objectSlots[handle.index].object = ptr;
+    
+    if (auto* body = ptr->getComponent<PhysicsBodyComponent>()) {
+        pendingBodies.push_back(body);
+    }
+    
+    // Only components with per-step work are scheduled
+    for (std::uint8_t i = 0; i < ptr->getComponentCount(); ++i) {
+        Component* component = ptr->getComponentAt(i);
+        UpdatePhase phase = component->getUpdatePhase();
+        if (phase != UpdatePhase::None) {
+            phaseComponents[static_cast<size_t>(phase)].push_back(component);
+        }
+    }
+    
+    TagMask tags = ptr->getTags();
+    for (TagId tag = 0; tags != 0; ++tag, tags >>= 1) {
+        if (tags & 1) taggedObjects[tag].push_back(ptr);
+    }
+    gameObjects.push_back(std::move(obj));
+    return ptr;
+}
+
+GameObjectHandle Engine::reserveHandle() {
+    std::uint32_t index;
+    if (!freeObjectSlots.empty()) {
+        index = freeObjectSlots.back();
+        freeObjectSlots.pop_back();
+    } else {
+        index = static_cast<std::uint32_t>(objectSlots.size());
+        objectSlots.emplace_back();
+    }
+    ObjectSlot& slot = objectSlots[index];
+    slot.inUse = true;
+    slot.object = nullptr;
+    return {index, slot.generation};
+}
+
+void Engine::releaseHandle(GameObjectHandle handle) {
+    ObjectSlot& slot = objectSlots[handle.index];
+    slot.object = nullptr;
+    slot.inUse = false;
+    if (++slot.generation == 0) slot.generation = 1;  // 0 is reserved for null handles
+    freeObjectSlots.push_back(handle.index);
+}
+
+GameObject* Engine::resolve(GameObjectHandle handle) const {
+    if (handle.isNull() || handle.index >= objectSlots.size()) return nullptr;
+    const ObjectSlot& slot = objectSlots[handle.index];
+    return slot.generation == handle.generation ? slot.object : nullptr;
+}
+
+bool Engine::isAlive(GameObjectHandle handle) const {
+    if (handle.isNull() || handle.index >= objectSlots.size()) return false;
+    const ObjectSlot& slot = objectSlots[handle.index];
+    return slot.inUse && slot.generation == handle.generation;
+}
+
+void Engine::clearGameObjects() {
+    for (auto& members : taggedObjects) {
+        members.clear();
+    }
+    for (auto& scheduled : phaseComponents) {
+        scheduled.clear();
+    }
+    for (std::uint32_t i = 0; i < objectSlots.size(); ++i) {
+        if (objectSlots[i].inUse) {
+            releaseHandle({i, objectSlots[i].generation});
+        }
+    }
+    gameObjects.clear();
+    pendingAsteroids.clear();
+    pendingBodies.clear();
+    player = nullptr;
+}
+
+void Engine::runUpdatePhase(UpdatePhase phase) {
+    // Indexed: a component may add objects (and so components) while the phase runs
+    std::vector<Component*>& scheduled = phaseComponents[static_cast<size_t>(phase)];
+    for (size_t i = 0; i < scheduled.size(); ++i) {
+        scheduled[i]->update(fixedDeltaTime);
+    }
+}
+
 void Engine::removeGameObject(GameObject* obj) {
     if (obj) {
         obj->markForDeletion();
     }
 }
 
+void Engine::removeGameObject(GameObjectHandle handle) {
+    if (!isAlive(handle)) return;
+    if (GameObject* obj = resolve(handle)) {
+        obj->markForDeletion();
+        return;
+    }
+    
+    // Still queued: drop the spawn and free the reserved slot
+    for (size_t i = 0; i < pendingAsteroids.size(); ++i) {
+        if (pendingAsteroids[i].handle == handle) {
+            pendingAsteroids.erase(pendingAsteroids.begin() + i);
+            releaseHandle(handle);
+            return;
+        }
+    }
+}
+
 void Engine::cleanupMarkedObjects() {
-    // Safe erasure pattern: iterate with manual index control
-    for (size_t i = 0; i < gameObjects.size(); ) {
-        if (gameObjects[i]->isMarkedForDeletion()) {
-            // Erase triggers GameObject destructor -> component destructors -> PhysicsBodyComponent cleanup
-            gameObjects.erase(gameObjects.begin() + i);
-            // Don't increment i since we removed an element
+    bool anyMarked = false;
+    for (const auto& obj : gameObjects) {
+        if (obj->isMarkedForDeletion()) {
+            anyMarked = true;
+            break;
+        }
+    }
+    if (!anyMarked) return;
+    
+    // Drop marked objects from the tag and phase lists before they are destroyed
+    for (auto& members : taggedObjects) {
+        members.erase(std::remove_if(members.begin(), members.end(),
+                                     [](GameObject* obj) { return obj->isMarkedForDeletion(); }),
+                      members.end());
+    }
+    for (auto& scheduled : phaseComponents) {
+        scheduled.erase(std::remove_if(scheduled.begin(), scheduled.end(),
+                                       [](Component* c) { return c->getOwner()->isMarkedForDeletion(); }),
+                        scheduled.end());
+    }
+    pendingBodies.erase(std::remove_if(pendingBodies.begin(), pendingBodies.end(),
+                                       [](PhysicsBodyComponent* body) { return body->getOwner()->isMarkedForDeletion(); }),
+                        pendingBodies.end());
+    
+    // One stable compaction pass: survivors slide down over destroyed objects, so
+    // culling many asteroids in one tick stays linear and gameObjects (update) order
+    // is kept. Draw order follows ComponentStore rows, which removal swaps.
+    size_t write = 0;
+    for (size_t read = 0; read < gameObjects.size(); ++read) {
+        if (gameObjects[read]->isMarkedForDeletion()) {
+            releaseHandle(gameObjects[read]->getHandle());
+            // Destroys the GameObject -> component destructors -> PhysicsBodyComponent cleanup
+            gameObjects[read].reset();
         } else {
-            ++i;
+            if (write != read) {
+                gameObjects[write] = std::move(gameObjects[read]);
+            }
+            ++write;
         }
     }
+    gameObjects.resize(write);
 }
 
 void Engine::processPendingAsteroids() {
+    ComponentStore::getInstance().reserve(ComponentStore::getInstance().size() + pendingAsteroids.size());
+    
     // Process all queued asteroid spawns
     for (const auto& pending : pendingAsteroids) {
         auto gameObj = std::make_unique<GameObject>();
-        gameObj->setTag("asteroid");
+        gameObj->setTag(Tags::Asteroid);
         
         // Transform
         auto* transform = gameObj->addComponent<TransformComponent>();
@@ -741,12 +1258,21 @@ void Engine::processPendingAsteroids() {
         auto* physics = gameObj->addComponent<PhysicsBodyComponent>();
         physics->setBodyType(BodyType::Static);
         physics->setShapeType(ShapeType::Circle);
+        physics->setCollisionLayer(CollisionLayers::Asteroid);
         
-        gameObjects.push_back(std::move(gameObj));
+        addGameObject(std::move(gameObj), pending.handle);
     }
     pendingAsteroids.clear();
 }
 
+void Engine::commitPendingBodies() {
+    if (pendingBodies.empty() || !b2World_IsValid(physicsWorldId)) return;
+    for (PhysicsBodyComponent* body : pendingBodies) {
+        body->createBody(physicsWorldId);
+    }
+    pendingBodies.clear();
+}
+
 void Engine::updateAsteroidSpawning() {
     // TODO: Implement procedural asteroid spawning based on camera/player position
     // Example logic:
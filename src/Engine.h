@@ -1,39 +1,68 @@
 #pragma once
 #include <SDL2/SDL.h>
 #include <box2d/box2d.h>
+#include "RenderSnapshot.h"
+#include "FramePacer.h"
+#include "InputState.h"
+#include "Tags.h"
+#include "GameObjectHandle.h"
+#include "Component.h"
+#include "CollisionDispatcher.h"
+#include <array>
+#include <atomic>
 #include <string>
 #include <map>
+#include <mutex>
 #include <memory>
 #include <vector>
 
 class GameObject;
+class PhysicsBodyComponent;
 
 class Engine {
 public:
     static Engine& getInstance();
     
-    bool init(const std::string& title, int width, int height);
+    bool init(const std::string& title, int width, int height, bool headless = false);
     void run();
     void quit();
     void clean();
     
     SDL_Renderer* getRenderer() { return renderer; }
     bool isRunning() { return running; }
+    bool isHeadless() const { return headless; }  // No window/renderer; textures are never created
     
     // Window dimensions
     int getWindowWidth() const { return windowWidth; }
     int getWindowHeight() const { return windowHeight; }
     
     // Frame rate control
-    static void setTargetFPS(int fps);
+    static void setTargetFPS(int fps);  // Render cap; can change while running (<= 0 = uncapped)
+    static int getTargetFPS() { return targetFPS; }
     static float getDeltaTime() { return deltaTime; }
     static void setLogicFPS(int fps);
     static int getLogicFPS() { return logicFPS; }
     static float getFixedDeltaTime() { return fixedDeltaTime; }
-    
-    // Mouse state
-    static int getMouseX() { return mouseX; }
-    static int getMouseY() { return mouseY; }
+    static void setTimeScale(float scale) { timeScale = scale; }  // <= 0 runs unthrottled (headless only)
+    static float getTimeScale() { return timeScale; }
+    void setMaxTicks(int ticks) { maxTicks = ticks > 0 ? static_cast<Uint64>(ticks) : 0; }
+    void setSimulationThread(bool enabled) { useSimulationThread = enabled; }  // Call before run()
+    void setMaxStepsPerFrame(int steps) { maxStepsPerFrame = steps > 0 ? steps : 1; }
+    void setSoftParticles(bool enabled);  // soft round particles instead of flat squares
+    
+    // Time dilation counters: frames that hit the step cap and simulated time skipped because of it
+    Uint64 getCappedFrameCount() const { return cappedFrames; }
+    double getDroppedSimulationTime() const { return droppedSimulationTime; }
+    
+    // Live objects, capacity and free-list reuse for each pooled object type, as
+    // copied by the simulation thread at the start of its latest step (profiling only)
+    void printPoolStats() const;
+    
+    // Input consumed by the current fixed step (live, recorded or replayed)
+    static const InputState& getInput() { return input; }
+    static const InputState& getPreviousInput() { return previousInput; }
+    static int getMouseX() { return input.mouseX; }
+    static int getMouseY() { return input.mouseY; }
     
     // Physics
     b2WorldId getPhysicsWorld() const { return physicsWorldId; }
@@ -45,18 +74,35 @@ public:
     GameObject* spawnBackground(const std::string& texture, float tileW, float tileH, float scrollX, float scrollY);
     GameObject* spawnPlayer(float x, float y, const std::string& texture, float spriteWidth,
                            float thrustForce, float maxSpeed);
-    GameObject* spawnAsteroid(float x, float y, float size);
+    GameObjectHandle spawnAsteroid(float x, float y, float size);  // Queued; the handle resolves once spawned
     
-    // Object lifecycle management
+    // Object lifecycle management. Set tags and add components before adding: the
+    // engine files the object under its tags and schedules its components by phase.
+    GameObject* addGameObject(std::unique_ptr<GameObject> obj);
     void removeGameObject(GameObject* obj);
+    void removeGameObject(GameObjectHandle handle);  // Also cancels a still-queued spawn
+    
+    // Handles: resolve() is nullptr for destroyed or still-queued objects; isAlive() is
+    // true for both live and queued ones
+    GameObject* resolve(GameObjectHandle handle) const;
+    bool isAlive(GameObjectHandle handle) const;
     void cleanupMarkedObjects();
     
     // Procedural generation (stubs for future use)
     void updateAsteroidSpawning();
     void cleanupOffscreenAsteroids();
     
+    // Gameplay callbacks for contacts between collision layers (dispatched after each step)
+    CollisionDispatcher& getCollisions() { return collisions; }
+    
     // Game object access (for components that need to iterate)
     std::vector<std::unique_ptr<GameObject>>& getGameObjects() { return gameObjects; }
+    // Every live object carrying a tag (includes objects already marked for deletion);
+    // empty for Tags::Invalid or any other ID past the table
+    const std::vector<GameObject*>& getObjectsWithTag(TagId tag) const {
+        static const std::vector<GameObject*> none;
+        return tag < Tags::MaxTags ? taggedObjects[tag] : none;
+    }
     
 public:
     // Score display
@@ -69,11 +115,11 @@ private:
     int score = 0;
     class ScoreDisplay* scoreDisplay = nullptr;
     class GameOverScreen* gameOverScreen = nullptr;
+    class PhysicsOverlay* physicsOverlay = nullptr;  // F5
     void updateAsteroidDifficulty();  // Update spawn rate based on score
     GameObject* player = nullptr;           // Reference to player for distance calculation
     float playerSpawnX = 0.0f, playerSpawnY = 0.0f;
     bool gameOver = false;
-    class InputComponent* gameOverInput = nullptr;  // Input component for checking spacebar after game over
     struct ExplosionConfig {
         int burstCount = 60;
         float burstDuration = 0.18f;
@@ -96,36 +142,104 @@ private:
     
     void handleEvents();
     void update();
-    void render();
+    void render(const RenderSnapshot& snapshot, float alpha);
+    void runHeadless();  // Simulation-only loop used when no renderer exists
+    void runThreaded();  // Render loop on this thread, simulationLoop() on its own thread
+    void simulationLoop();
+    int runFixedSteps(double& accumulator);  // Up to maxStepsPerFrame updates (never past maxTicks); returns how many ran
+    void printTimeDilationSummary() const;
+    
+    // Render snapshots: the simulation fills one after its fixed steps, rendering only reads published ones
+    void buildSnapshot(RenderSnapshot& out);
+    void publishSnapshot();
+    void updateHud(const RenderSnapshot& snapshot);  // Rebuilds HUD textures on the render thread when values change
     
     SDL_Window* window = nullptr;
     SDL_Renderer* renderer = nullptr;
-    bool running = false;
+    class SceneRenderer* sceneRenderer = nullptr;
+    RenderCullStats cullStats;  // view culling counts for the last rendered frame (F3)
+    std::atomic<bool> running{false};
+    bool headless = false;
+    bool useSimulationThread = false;
+    RenderSnapshotBuffer snapshots;
+    FramePacer framePacer;  // paces the render loop (or the only loop when single-threaded)
+    
+    // Values currently shown by the HUD textures (render thread only)
+    int hudScore = -1;
+    int hudGameOverScore = -1;
+    int hudHighScore = -1;
     int windowWidth = 0;
     int windowHeight = 0;
     
     // Frame rate limiting
-    static int targetFPS;
+    static std::atomic<int> targetFPS;
     static float deltaTime;
     static int logicFPS;          // Fixed update frequency (independent of render FPS)
     static float fixedDeltaTime;  // Fixed timestep in seconds
+    static float timeScale;       // Simulated seconds per real second
     Uint32 lastFrameTime = 0;
-    
-    // Mouse state
-    static int mouseX;
-    static int mouseY;
+    Uint64 tickCount = 0;         // Fixed updates executed since run() started
+    Uint64 maxTicks = 0;          // Stop after this many fixed updates (0 = unlimited)
+    int maxStepsPerFrame = 8;     // Catch-up limit; time beyond it is dropped (game slows down)
+    Uint64 cappedFrames = 0;
+    double droppedSimulationTime = 0.0;  // seconds
+    
+    // Input: handleEvents() samples liveInput on the event thread, update() takes one InputState per step
+    static InputState input;
+    static InputState previousInput;
+    InputState liveInput;
+    std::mutex liveInputMutex;
+    
+    // ObjectPool and shape cache counters are not thread-safe; the simulation thread copies them here for F3
+    struct PoolStatsRow {
+        const char* name = "";
+        size_t live = 0;
+        size_t capacity = 0;
+        unsigned long long hits = 0;
+        unsigned long long misses = 0;
+    };
+    std::array<PoolStatsRow, 6> poolStats;
+    size_t shapeCacheSize = 0;       // PhysicsShapeCache, same route
+    size_t shapeCacheHits = 0;
+    size_t shapeCacheMisses = 0;
+    mutable std::mutex poolStatsMutex;
+    void capturePoolStats();
     
     // Physics
     b2WorldId physicsWorldId = b2_nullWorldId;
+    CollisionDispatcher collisions;
+    void registerCollisionHandlers();
+    void onPlayerHitAsteroid(GameObject* playerHit, GameObject* asteroid);
     
     // Game objects
     std::vector<std::unique_ptr<GameObject>> gameObjects;
+    std::array<std::vector<GameObject*>, Tags::MaxTags> taggedObjects;  // tag ID -> members
+    std::array<std::vector<Component*>, static_cast<size_t>(UpdatePhase::Count)> phaseComponents;
+    void runUpdatePhase(UpdatePhase phase);
+    void clearGameObjects();
+    
+    // Handle slots (index = GameObjectHandle::index); generation bumps on release
+    struct ObjectSlot {
+        GameObject* object = nullptr;
+        std::uint32_t generation = 1;
+        bool inUse = false;           // live object or reserved for a queued spawn
+    };
+    std::vector<ObjectSlot> objectSlots;
+    std::vector<std::uint32_t> freeObjectSlots;
+    GameObjectHandle reserveHandle();
+    void releaseHandle(GameObjectHandle handle);
+    GameObject* addGameObject(std::unique_ptr<GameObject> obj, GameObjectHandle handle);
     
     // Asteroid spawn queue (processed after update loop to avoid vector reallocation issues)
     struct PendingAsteroid {
         float x, y, size;
+        GameObjectHandle handle;  // reserved at queue time so callers can refer to it
     };
     std::vector<PendingAsteroid> pendingAsteroids;
     
     void processPendingAsteroids();  // Called after updates to spawn queued asteroids
+    
+    // Physics bodies of added objects, created together by commitPendingBodies
+    std::vector<PhysicsBodyComponent*> pendingBodies;
+    void commitPendingBodies();
 };
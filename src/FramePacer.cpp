@@ -0,0 +1,72 @@
+#include "FramePacer.h"
+
+namespace {
+    const double SpinMarginMs = 0.25;        // always leave at least this much to the spin
+    const double MaxOvershootSampleMs = 8.0; // one descheduled sleep should not skew the average
+    const double OvershootSmoothing = 0.1;
+}
+
+FramePacer::FramePacer(int fps)
+    : targetFPS(fps), frequency(SDL_GetPerformanceFrequency()) {
+    frameStart = SDL_GetPerformanceCounter();
+    nextDeadline = frameStart;
+}
+
+double FramePacer::beginFrame() {
+    Uint64 now = SDL_GetPerformanceCounter();
+    double elapsed = static_cast<double>(now - frameStart) / frequency;
+    frameStart = now;
+    return elapsed;
+}
+
+void FramePacer::waitForNextFrame() {
+    int fps = targetFPS;
+    if (fps <= 0) {
+        scheduledFPS = 0;
+        return;
+    }
+    
+    Uint64 period = frequency / static_cast<Uint64>(fps);
+    Uint64 now = SDL_GetPerformanceCounter();
+    
+    // Deadlines advance by whole periods so rounding never drifts the rate. After a
+    // rate change or a hitch longer than a frame, restart the schedule from this
+    // frame instead of rushing through frames to catch up.
+    if (fps != scheduledFPS || now > nextDeadline + period) {
+        nextDeadline = frameStart + period;
+        scheduledFPS = fps;
+    } else {
+        nextDeadline += period;
+    }
+    
+    if (now < nextDeadline) {
+        waitUntil(nextDeadline);
+    }
+}
+
+void FramePacer::waitUntil(Uint64 deadline) {
+    const double countsPerMs = static_cast<double>(frequency) / 1000.0;
+    
+    // Coarse sleeps while there is comfortably more than one oversleep left
+    for (;;) {
+        Uint64 now = SDL_GetPerformanceCounter();
+        if (now >= deadline) return;
+        
+        double remainingMs = static_cast<double>(deadline - now) / countsPerMs;
+        double sleepMs = remainingMs - sleepOvershootMs - SpinMarginMs;
+        if (sleepMs < 1.0) break;
+        
+        Uint32 requestedMs = static_cast<Uint32>(sleepMs);
+        SDL_Delay(requestedMs);
+        
+        double actualMs = static_cast<double>(SDL_GetPerformanceCounter() - now) / countsPerMs;
+        double overshoot = actualMs - requestedMs;
+        if (overshoot < 0.0) overshoot = 0.0;
+        if (overshoot > MaxOvershootSampleMs) overshoot = MaxOvershootSampleMs;
+        sleepOvershootMs += (overshoot - sleepOvershootMs) * OvershootSmoothing;
+    }
+    
+    // Spin out the remainder; sub-millisecond sleeps are not reliable anywhere
+    while (SDL_GetPerformanceCounter() < deadline) {
+    }
+}
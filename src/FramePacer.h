@@ -0,0 +1,33 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <atomic>
+
+// Paces a loop to a target rate using the high-resolution performance counter.
+// Waits sleep in whole milliseconds while the deadline is far away and spin for
+// the rest; how much SDL_Delay oversleeps is measured and taken off later sleeps.
+class FramePacer {
+public:
+    explicit FramePacer(int targetFPS = 60);
+    
+    // Safe to call from any thread while the loop runs; <= 0 removes the cap
+    void setTargetFPS(int fps) { targetFPS = fps; }
+    int getTargetFPS() const { return targetFPS; }
+    
+    // Call at the top of each iteration; returns seconds since the previous call
+    double beginFrame();
+    
+    // Blocks until the next frame is due (returns immediately when uncapped or late)
+    void waitForNextFrame();
+    
+    double getSleepOvershootMs() const { return sleepOvershootMs; }
+    
+private:
+    void waitUntil(Uint64 deadline);
+    
+    std::atomic<int> targetFPS;
+    Uint64 frequency;
+    Uint64 frameStart = 0;
+    Uint64 nextDeadline = 0;
+    int scheduledFPS = 0;           // rate the current deadline schedule was built for
+    double sleepOvershootMs = 1.0;  // moving average of (actual - requested) SDL_Delay time
+};
@@ -0,0 +1,137 @@
+#include "FrameProfiler.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+bool FrameProfiler::enabled = false;
+
+RollingStats::RollingStats(size_t capacity) {
+    samples.resize(capacity > 0 ? capacity : 1);
+    scratch.reserve(samples.size());
+}
+
+void RollingStats::add(double value) {
+    samples[next] = value;
+    next = (next + 1) % samples.size();
+    if (next == 0) filled = true;
+    ++totalCount;
+}
+
+void RollingStats::clear() {
+    next = 0;
+    filled = false;
+    totalCount = 0;
+}
+
+double RollingStats::getMean() const {
+    size_t count = getCount();
+    if (count == 0) return 0.0;
+    double sum = 0.0;
+    for (size_t i = 0; i < count; ++i) sum += samples[i];
+    return sum / count;
+}
+
+double RollingStats::getMax() const {
+    size_t count = getCount();
+    if (count == 0) return 0.0;
+    return *std::max_element(samples.begin(), samples.begin() + count);
+}
+
+double RollingStats::getLatest() const {
+    if (getCount() == 0) return 0.0;
+    return samples[(next + samples.size() - 1) % samples.size()];
+}
+
+double RollingStats::getPercentile(double p) const {
+    size_t count = getCount();
+    if (count == 0) return 0.0;
+    
+    scratch.assign(samples.begin(), samples.begin() + count);
+    p = std::min(std::max(p, 0.0), 100.0);
+    size_t rank = static_cast<size_t>(p / 100.0 * (count - 1) + 0.5);
+    std::nth_element(scratch.begin(), scratch.begin() + rank, scratch.end());
+    return scratch[rank];
+}
+
+FrameProfiler::FrameProfiler() {
+    setWindowSize(1024);
+}
+
+void FrameProfiler::setWindowSize(size_t samplesPerPhase) {
+    stats.assign(static_cast<size_t>(ProfilePhase::Count), RollingStats(samplesPerPhase));
+}
+
+void FrameProfiler::record(ProfilePhase phase, double milliseconds) {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    stats[static_cast<size_t>(phase)].add(milliseconds);
+}
+
+double FrameProfiler::toMilliseconds(Uint64 counterDelta) {
+    static const double msPerCount = 1000.0 / static_cast<double>(SDL_GetPerformanceFrequency());
+    return static_cast<double>(counterDelta) * msPerCount;
+}
+
+const char* FrameProfiler::getPhaseName(ProfilePhase phase) {
+    switch (phase) {
+        case ProfilePhase::Frame: return "frame";
+        case ProfilePhase::Events: return "events";
+        case ProfilePhase::Update: return "update";
+        case ProfilePhase::PhysicsStep: return "physics_step";
+        case ProfilePhase::Contacts: return "contacts";
+        case ProfilePhase::ObjectUpdate: return "object_update";
+        case ProfilePhase::PhysicsSync: return "physics_sync";
+        case ProfilePhase::LateUpdate: return "late_update";
+        case ProfilePhase::Particles: return "particles";
+        case ProfilePhase::Cleanup: return "cleanup";
+        case ProfilePhase::SpawnQueue: return "spawn_queue";
+        case ProfilePhase::Render: return "render";
+        case ProfilePhase::RenderObjects: return "render_objects";
+        case ProfilePhase::RenderParticles: return "render_particles";
+        case ProfilePhase::RenderDebug: return "render_debug";
+        case ProfilePhase::RenderHud: return "render_hud";
+        case ProfilePhase::Present: return "present";
+        default: return "unknown";
+    }
+}
+
+void FrameProfiler::printSummary(double frameBudgetMs, double updateBudgetMs) const {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    std::printf("%-18s %10s %9s %9s %9s %9s %9s\n", "phase (ms)", "samples", "mean", "p50", "p95", "p99", "max");
+    for (size_t i = 0; i < stats.size(); ++i) {
+        const RollingStats& s = stats[i];
+        if (s.getTotalCount() == 0) continue;
+        ProfilePhase phase = static_cast<ProfilePhase>(i);
+        std::printf("%-18s %10llu %9.3f %9.3f %9.3f %9.3f %9.3f", getPhaseName(phase), s.getTotalCount(),
+                    s.getMean(), s.getPercentile(50.0), s.getPercentile(95.0), s.getPercentile(99.0), s.getMax());
+        if (phase == ProfilePhase::Frame) std::printf("  (budget %.3f)", frameBudgetMs);
+        if (phase == ProfilePhase::Update) std::printf("  (budget %.3f)", updateBudgetMs);
+        std::printf("\n");
+    }
+    std::fflush(stdout);
+}
+
+bool FrameProfiler::writeCSV(const std::string& path) const {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "Profiler: could not open '" << path << "' for writing" << std::endl;
+        return false;
+    }
+    
+    file << "phase,samples,window,mean_ms,p50_ms,p95_ms,p99_ms,max_ms\n";
+    for (size_t i = 0; i < stats.size(); ++i) {
+        const RollingStats& s = stats[i];
+        file << getPhaseName(static_cast<ProfilePhase>(i)) << ','
+             << s.getTotalCount() << ','
+             << s.getCount() << ','
+             << s.getMean() << ','
+             << s.getPercentile(50.0) << ','
+             << s.getPercentile(95.0) << ','
+             << s.getPercentile(99.0) << ','
+             << s.getMax() << '\n';
+    }
+    
+    std::cout << "Profiler: wrote " << path << std::endl;
+    return true;
+}
@@ -0,0 +1,111 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Engine phases timed by the frame profiler. Update phases are sampled once per
+// fixed step; render phases once per rendered frame.
+enum class ProfilePhase {
+    Frame,           // events + updates + render, excluding the frame-limit sleep
+    Events,          // Engine::handleEvents
+    Update,          // one whole fixed step (Engine::update)
+    PhysicsStep,     // b2World_Step
+    Contacts,        // contact event processing
+    ObjectUpdate,    // Input + Gameplay update phases
+    PhysicsSync,     // transform sync + PhysicsSync update phase
+    LateUpdate,      // Camera + Late update phases
+    Particles,       // ParticleSystem::update
+    Cleanup,         // Engine::cleanupMarkedObjects
+    SpawnQueue,      // Engine::processPendingAsteroids
+    Render,          // one whole Engine::render
+    RenderObjects,   // SceneRenderer backgrounds + sprites
+    RenderParticles, // ParticleSystem::render
+    RenderDebug,     // PhysicsDebugDraw::render + physics overlay
+    RenderHud,       // score / game over overlay
+    Present,         // SDL_RenderPresent
+    Count
+};
+
+// Fixed-size rolling window of samples with percentile queries
+class RollingStats {
+public:
+    explicit RollingStats(size_t capacity = 1024);
+    
+    void add(double value);
+    void clear();
+    
+    size_t getCount() const { return filled ? samples.size() : next; }
+    unsigned long long getTotalCount() const { return totalCount; }
+    double getMean() const;
+    double getMax() const;
+    double getLatest() const;
+    double getPercentile(double p) const;  // p in [0, 100]
+    
+private:
+    std::vector<double> samples;
+    mutable std::vector<double> scratch;   // reused by getPercentile to avoid allocations
+    size_t next = 0;
+    bool filled = false;
+    unsigned long long totalCount = 0;
+};
+
+// Singleton collecting per-phase timings (in milliseconds)
+class FrameProfiler {
+public:
+    static FrameProfiler& getInstance() {
+        static FrameProfiler instance;
+        return instance;
+    }
+    
+    FrameProfiler(const FrameProfiler&) = delete;
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+    
+    static bool isEnabled() { return enabled; }
+    void setEnabled(bool e) { enabled = e; }
+    void setWindowSize(size_t samplesPerPhase);
+    
+    void record(ProfilePhase phase, double milliseconds);
+    // Copy taken under the lock, since record() runs on the simulation and render threads
+    RollingStats getStats(ProfilePhase phase) const {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        return stats[static_cast<size_t>(phase)];
+    }
+    
+    static const char* getPhaseName(ProfilePhase phase);
+    
+    // Summary table to stdout; budgets (ms) are shown next to Frame and Update
+    void printSummary(double frameBudgetMs, double updateBudgetMs) const;
+    bool writeCSV(const std::string& path) const;
+    
+    // Converts a performance counter delta to milliseconds
+    static double toMilliseconds(Uint64 counterDelta);
+    
+private:
+    FrameProfiler();
+    
+    static bool enabled;
+    std::vector<RollingStats> stats;
+    mutable std::mutex statsMutex;  // simulation and render threads record concurrently
+};
+
+// RAII timer for one phase; does nothing when profiling is disabled
+class ProfileScope {
+public:
+    explicit ProfileScope(ProfilePhase phase)
+        : phase(phase), start(FrameProfiler::isEnabled() ? SDL_GetPerformanceCounter() : 0) {}
+    
+    ~ProfileScope() {
+        if (start != 0) {
+            FrameProfiler::getInstance().record(phase, FrameProfiler::toMilliseconds(SDL_GetPerformanceCounter() - start));
+        }
+    }
+    
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+    
+private:
+    ProfilePhase phase;
+    Uint64 start;
+};
@@ -1,28 +1,42 @@
 #include "GameObject.h"
 #include "Component.h"
+#include <cstdlib>
+#include <iostream>
 
-void GameObject::update(float deltaTime) {
-    for (auto& component : components) {
-        component->update(deltaTime);
+GameObject::~GameObject() {
+    // Tear down in reverse order of addition so components can still reach the
+    // ones they depend on (e.g. sprite and physics clear their ComponentStore row)
+    while (componentCount > 0) {
+        components[--componentCount].reset();
     }
 }
 
-void GameObject::render() {
-    for (auto& component : components) {
-        component->render();
+void GameObject::componentLimitExceeded(const char* limit) {
+    std::cerr << "GameObject::addComponent: too many components, raise " << limit << std::endl;
+    std::abort();
+}
+
+void GameObject::snapshot(RenderSnapshot& out) const {
+    for (std::uint8_t i = 0; i < componentCount; ++i) {
+        components[i]->snapshot(out);
     }
 }
 
+void GameObject::setTag(TagId newTag) {
+    primaryTag = newTag;
+    tags = Tags::toMask(newTag);
+}
+
 void GameObject::setTag(const std::string& newTag) {
-    tag = newTag;
+    setTag(Tags::intern(newTag));
 }
 
 const std::string& GameObject::getTag() const {
-    return tag;
+    return Tags::getName(primaryTag);
 }
 
 bool GameObject::hasTag(const std::string& tagToCheck) const {
-    return tag == tagToCheck;
+    return hasTag(Tags::find(tagToCheck));
 }
 
 void GameObject::markForDeletion() {
@@ -1,52 +1,81 @@
 #pragma once
-#include <vector>
+#include "Component.h"
+#include "ObjectPool.h"
+#include "Tags.h"
+#include "GameObjectHandle.h"
+#include <array>
+#include <cstdint>
 #include <memory>
-#include <typeindex>
-#include <unordered_map>
 #include <string>
 
-class Component;
+struct RenderSnapshot;
 
-class GameObject {
+class GameObject : public Pooled<GameObject> {
 public:
-    GameObject() = default;
-    ~GameObject() = default;
+    GameObject() { componentSlots.fill(NoComponent); }
+    ~GameObject();
     
-    void update(float deltaTime);
-    void render();
+    void snapshot(RenderSnapshot& out) const;
     
     template<typename T>
     T* addComponent() {
+        // Checked in release builds too: either overflow would write past the fixed arrays
+        ComponentTypeId id = getComponentTypeId<T>();
+        if (id >= MaxComponentTypes) componentLimitExceeded("MaxComponentTypes");
+        if (componentCount >= MaxComponentsPerObject) componentLimitExceeded("MaxComponentsPerObject");
+        
         auto component = std::make_unique<T>();
         component->setOwner(this);
         T* ptr = component.get();
-        components.push_back(std::move(component));
-        componentMap[std::type_index(typeid(T))] = ptr;
+        componentSlots[id] = componentCount;
+        components[componentCount++] = std::move(component);
         ptr->init();
         return ptr;
     }
     
     template<typename T>
-    T* getComponent() {
-        auto it = componentMap.find(std::type_index(typeid(T)));
-        if (it != componentMap.end()) {
-            return static_cast<T*>(it->second);
-        }
-        return nullptr;
+    T* getComponent() const {
+        // A type past the table can never have been added
+        ComponentTypeId id = getComponentTypeId<T>();
+        if (id >= MaxComponentTypes) return nullptr;
+        std::uint8_t slot = componentSlots[id];
+        return slot != NoComponent ? static_cast<T*>(components[slot].get()) : nullptr;
     }
     
-    // Tagging system
+    // Tagging system. Tags are fixed once the object is handed to Engine::addGameObject,
+    // which files it under each of its tags.
+    void setTag(TagId newTag);                   // replaces all tags
     void setTag(const std::string& newTag);
-    const std::string& getTag() const;
+    void addTag(TagId extraTag) { tags |= Tags::toMask(extraTag); }
+    const std::string& getTag() const;           // first tag set by setTag
+    TagMask getTags() const { return tags; }
+    bool hasTag(TagId tagToCheck) const { return (tags & Tags::toMask(tagToCheck)) != 0; }
     bool hasTag(const std::string& tagToCheck) const;
     
     // Deletion management
     void markForDeletion();
     bool isMarkedForDeletion() const;
     
+    std::uint8_t getComponentCount() const { return componentCount; }
+    Component* getComponentAt(std::uint8_t i) const { return components[i].get(); }
+    
+    // Assigned by Engine::addGameObject; null until then
+    GameObjectHandle getHandle() const { return handle; }
+    
 private:
-    std::vector<std::unique_ptr<Component>> components;
-    std::unordered_map<std::type_index, Component*> componentMap;
-    std::string tag;
+    friend class Engine;
+    GameObjectHandle handle;
+
+    [[noreturn]] static void componentLimitExceeded(const char* limit);  // logs and aborts
+    
+    static constexpr std::uint8_t NoComponent = 0xFF;
+    static constexpr std::uint8_t MaxComponentsPerObject = 12;  // the player uses 9
+    
+    // Stored inline so a pooled GameObject needs no extra allocation per spawn
+    std::array<std::unique_ptr<Component>, MaxComponentsPerObject> components;
+    std::uint8_t componentCount = 0;
+    std::array<std::uint8_t, MaxComponentTypes> componentSlots;  // type ID -> index into components
+    TagMask tags = 0;
+    TagId primaryTag = Tags::Invalid;
     bool markedForDeletion = false;
 };
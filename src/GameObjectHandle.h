@@ -0,0 +1,31 @@
+#pragma once
+#include <cstdint>
+
+// Weak reference to a GameObject owned by the Engine: a slot index plus the
+// generation that slot had when the handle was made. Once the object is
+// destroyed the slot's generation moves on, so Engine::resolve() returns
+// nullptr for the stale handle instead of a dangling pointer.
+struct GameObjectHandle {
+    std::uint32_t index = 0;
+    std::uint32_t generation = 0;  // 0 = null handle (live slots start at 1)
+    
+    bool isNull() const { return generation == 0; }
+    bool operator==(const GameObjectHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const GameObjectHandle& other) const { return !(*this == other); }
+    
+    // Packs the handle into Box2D's void* user data (null handle <-> nullptr)
+    void* toUserData() const {
+        static_assert(sizeof(std::uintptr_t) >= 8, "handle packing needs 64-bit pointers");
+        return reinterpret_cast<void*>((static_cast<std::uintptr_t>(generation) << 32) | index);
+    }
+    
+    static GameObjectHandle fromUserData(void* userData) {
+        std::uintptr_t bits = reinterpret_cast<std::uintptr_t>(userData);
+        GameObjectHandle handle;
+        handle.index = static_cast<std::uint32_t>(bits & 0xFFFFFFFFu);
+        handle.generation = static_cast<std::uint32_t>(bits >> 32);
+        return handle;
+    }
+};
@@ -1,46 +1,42 @@
 #include "InputComponent.h"
-#include <cstring>
-#include <cstdio>
+#include "Engine.h"
 
 void InputComponent::update(float deltaTime) {
     // Save previous state
-    if (currentKeyStates) {
-        std::memcpy(previousKeyStates, currentKeyStates, SDL_NUM_SCANCODES);
-    }
-    previousMouseState = currentMouseState;
+    previous = current;
     
-    // Get current state
-    currentKeyStates = SDL_GetKeyboardState(nullptr);
-    currentMouseState = SDL_GetMouseState(nullptr, nullptr);
+    // Get current state (recorded/replayed by the engine, never read from SDL here)
+    current = Engine::getInput();
 }
 
 bool InputComponent::isKeyPressed(SDL_Scancode key) const {
     // Just pressed this frame (was up, now down)
-    return currentKeyStates && currentKeyStates[key] && !previousKeyStates[key];
+    InputKey tracked;
+    return InputState::fromScancode(key, tracked) && current.isKeyDown(tracked) && !previous.isKeyDown(tracked);
 }
 
 bool InputComponent::isKeyDown(SDL_Scancode key) const {
     // Currently held down
-    return currentKeyStates && currentKeyStates[key];
+    InputKey tracked;
+    return InputState::fromScancode(key, tracked) && current.isKeyDown(tracked);
 }
 
 bool InputComponent::isKeyUp(SDL_Scancode key) const {
     // Currently not pressed
-    return currentKeyStates && !currentKeyStates[key];
+    return !isKeyDown(key);
 }
 
 bool InputComponent::isMouseButtonPressed(int button) const {
     // Just pressed this frame (was up, now down)
-    Uint32 buttonMask = SDL_BUTTON(button);
-    return (currentMouseState & buttonMask) && !(previousMouseState & buttonMask);
+    return current.isMouseButtonDown(button) && !previous.isMouseButtonDown(button);
 }
 
 bool InputComponent::isMouseButtonDown(int button) const {
     // Currently held down
-    return (currentMouseState & SDL_BUTTON(button)) != 0;
+    return current.isMouseButtonDown(button);
 }
 
 bool InputComponent::isMouseButtonUp(int button) const {
     // Currently not pressed
-    return (currentMouseState & SDL_BUTTON(button)) == 0;
+    return !current.isMouseButtonDown(button);
 }
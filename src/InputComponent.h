@@ -1,13 +1,19 @@
 #pragma once
 #include "Component.h"
+#include "InputState.h"
 #include <SDL2/SDL.h>
 
+// Per-object view of the engine's per-step InputState. Only keys listed in
+// InputKey are tracked; other scancodes always read as up.
+
 class InputComponent : public Component {
 public:
     InputComponent() = default;
     
     void update(float deltaTime) override;
     
+    UpdatePhase getUpdatePhase() const override { return UpdatePhase::Input; }
+    
     bool isKeyPressed(SDL_Scancode key) const;
     bool isKeyDown(SDL_Scancode key) const;
     bool isKeyUp(SDL_Scancode key) const;
@@ -30,9 +36,6 @@ public:
     bool isRightMouseDown() const { return isMouseButtonDown(SDL_BUTTON_RIGHT); }
     
 private:
-    const Uint8* currentKeyStates = nullptr;
-    Uint8 previousKeyStates[SDL_NUM_SCANCODES] = {0};
-    
-    Uint32 currentMouseState = 0;
-    Uint32 previousMouseState = 0;
+    InputState current;
+    InputState previous;
 };
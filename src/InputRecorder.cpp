@@ -0,0 +1,138 @@
+#include "InputRecorder.h"
+#include <iostream>
+
+namespace {
+    const char Magic[4] = {'G', 'S', 'I', 'N'};
+    const Uint32 FormatVersion = 1;
+    const size_t TickSize = 6;
+    
+    void writeU32(std::ostream& out, Uint32 value) {
+        const char bytes[4] = {
+            static_cast<char>(value & 0xFF), static_cast<char>((value >> 8) & 0xFF),
+            static_cast<char>((value >> 16) & 0xFF), static_cast<char>((value >> 24) & 0xFF)
+        };
+        out.write(bytes, 4);
+    }
+    
+    bool readU32(std::istream& in, Uint32& value) {
+        unsigned char bytes[4];
+        if (!in.read(reinterpret_cast<char*>(bytes), 4)) return false;
+        value = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (static_cast<Uint32>(bytes[3]) << 24);
+        return true;
+    }
+    
+    Sint16 clampToI16(int value) {
+        if (value < -32768) return -32768;
+        if (value > 32767) return 32767;
+        return static_cast<Sint16>(value);
+    }
+}
+
+bool InputRecorder::startRecording(const std::string& filePath, const InputRecordingHeader& newHeader) {
+    close();
+    
+    recordFile.open(filePath, std::ios::binary | std::ios::trunc);
+    if (!recordFile) {
+        std::cerr << "InputRecorder: could not open '" << filePath << "' for writing" << std::endl;
+        return false;
+    }
+    
+    header = newHeader;
+    path = filePath;
+    recordFile.write(Magic, 4);
+    writeU32(recordFile, FormatVersion);
+    writeU32(recordFile, header.seed);
+    writeU32(recordFile, static_cast<Uint32>(header.logicFPS));
+    writeU32(recordFile, static_cast<Uint32>(header.windowWidth));
+    writeU32(recordFile, static_cast<Uint32>(header.windowHeight));
+    
+    mode = Mode::Record;
+    recordedTicks = 0;
+    std::cout << "Recording input to " << path << " (seed " << header.seed << ")" << std::endl;
+    return true;
+}
+
+bool InputRecorder::startReplay(const std::string& filePath) {
+    close();
+    
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file) {
+        std::cerr << "InputRecorder: could not open '" << filePath << "'" << std::endl;
+        return false;
+    }
+    
+    char magic[4];
+    Uint32 version = 0, seed = 0, logicFPS = 0, width = 0, height = 0;
+    if (!file.read(magic, 4) || std::string(magic, 4) != std::string(Magic, 4) ||
+        !readU32(file, version) || version != FormatVersion ||
+        !readU32(file, seed) || !readU32(file, logicFPS) ||
+        !readU32(file, width) || !readU32(file, height)) {
+        std::cerr << "InputRecorder: '" << filePath << "' is not a version " << FormatVersion
+                  << " input recording" << std::endl;
+        return false;
+    }
+    
+    replayTicks.clear();
+    unsigned char tick[TickSize];
+    while (file.read(reinterpret_cast<char*>(tick), TickSize)) {
+        InputState state;
+        state.mouseX = static_cast<Sint16>(tick[0] | (tick[1] << 8));
+        state.mouseY = static_cast<Sint16>(tick[2] | (tick[3] << 8));
+        state.mouseButtons = tick[4];
+        state.keys = tick[5];
+        replayTicks.push_back(state);
+    }
+    
+    header.seed = seed;
+    header.logicFPS = static_cast<int>(logicFPS);
+    header.windowWidth = static_cast<int>(width);
+    header.windowHeight = static_cast<int>(height);
+    path = filePath;
+    replayIndex = 0;
+    mode = Mode::Replay;
+    
+    std::cout << "Replaying " << replayTicks.size() << " ticks from " << path
+              << " (seed " << seed << ", logicFPS " << logicFPS << ")" << std::endl;
+    return true;
+}
+
+void InputRecorder::close() {
+    if (mode == Mode::Record) {
+        recordFile.close();
+        std::cout << "Recorded " << recordedTicks << " ticks to " << path << std::endl;
+    } else if (mode == Mode::Replay) {
+        std::cout << "Replayed " << replayIndex << " of " << replayTicks.size() << " ticks" << std::endl;
+        replayTicks.clear();
+        replayIndex = 0;
+    }
+    mode = Mode::Live;
+}
+
+InputState InputRecorder::nextTick(const InputState& live) {
+    if (mode == Mode::Replay) {
+        return replayIndex < replayTicks.size() ? replayTicks[replayIndex++] : InputState();
+    }
+    
+    if (mode == Mode::Record) {
+        Sint16 x = clampToI16(live.mouseX);
+        Sint16 y = clampToI16(live.mouseY);
+        const char tick[TickSize] = {
+            static_cast<char>(x & 0xFF), static_cast<char>((x >> 8) & 0xFF),
+            static_cast<char>(y & 0xFF), static_cast<char>((y >> 8) & 0xFF),
+            static_cast<char>(live.mouseButtons & 0xFF),
+            static_cast<char>(live.keys & 0xFF)
+        };
+        recordFile.write(tick, TickSize);
+        ++recordedTicks;
+        
+        // The stored values are what a replay will see; simulate with exactly those
+        InputState stored = live;
+        stored.mouseX = x;
+        stored.mouseY = y;
+        stored.mouseButtons &= 0xFF;
+        stored.keys &= 0xFF;
+        return stored;
+    }
+    
+    return live;
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include "InputState.h"
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Run parameters stored at the start of an input recording. Replays reuse them
+// so the same seed and fixed step produce the same simulation tick for tick.
+struct InputRecordingHeader {
+    Uint32 seed = 0;
+    int logicFPS = 60;
+    int windowWidth = 0;   // mouse coordinates are relative to this window size
+    int windowHeight = 0;
+};
+
+// Records the per-tick InputState to a compact binary file, or feeds a recording
+// back in place of live input.
+//
+// File layout (little-endian): "GSIN", u32 version, u32 seed, u32 logicFPS,
+// u32 width, u32 height, then 6 bytes per tick: i16 mouseX, i16 mouseY,
+// u8 mouse buttons, u8 key bits.
+class InputRecorder {
+public:
+    enum class Mode { Live, Record, Replay };
+    
+    static InputRecorder& getInstance() {
+        static InputRecorder instance;
+        return instance;
+    }
+    
+    InputRecorder(const InputRecorder&) = delete;
+    InputRecorder& operator=(const InputRecorder&) = delete;
+    
+    bool startRecording(const std::string& path, const InputRecordingHeader& header);
+    bool startReplay(const std::string& path);  // Loads the whole file; header via getHeader()
+    void close();                               // Flushes a recording; reports a replay
+    
+    // Returns the input for the next fixed step. Live/Record use the given live
+    // sample (recording it); Replay ignores it and returns the recorded tick.
+    InputState nextTick(const InputState& live);
+    
+    bool isReplayFinished() const { return mode == Mode::Replay && replayIndex >= replayTicks.size(); }
+    Mode getMode() const { return mode; }
+    const InputRecordingHeader& getHeader() const { return header; }
+    
+private:
+    InputRecorder() = default;
+    
+    Mode mode = Mode::Live;
+    InputRecordingHeader header;
+    std::ofstream recordFile;
+    std::string path;
+    size_t recordedTicks = 0;
+    std::vector<InputState> replayTicks;
+    size_t replayIndex = 0;
+};
@@ -0,0 +1,62 @@
+#pragma once
+#include <SDL2/SDL.h>
+
+// Keys the simulation reads. Only these are sampled, recorded and replayed.
+enum class InputKey : Uint8 {
+    W,
+    A,
+    S,
+    D,
+    Space,
+    F2,      // debug asteroid toggle (MoveComponent)
+    Count
+};
+
+// Everything the simulation consumes from the player during one fixed step
+struct InputState {
+    int mouseX = 0;          // window coordinates
+    int mouseY = 0;
+    Uint32 mouseButtons = 0; // SDL_BUTTON() mask
+    Uint32 keys = 0;         // bit per InputKey
+    
+    bool isKeyDown(InputKey key) const { return (keys & keyBit(key)) != 0; }
+    bool isMouseButtonDown(int button) const { return (mouseButtons & SDL_BUTTON(button)) != 0; }
+    
+    static Uint32 keyBit(InputKey key) { return 1u << static_cast<Uint32>(key); }
+    
+    static SDL_Scancode toScancode(InputKey key) {
+        switch (key) {
+            case InputKey::W: return SDL_SCANCODE_W;
+            case InputKey::A: return SDL_SCANCODE_A;
+            case InputKey::S: return SDL_SCANCODE_S;
+            case InputKey::D: return SDL_SCANCODE_D;
+            case InputKey::Space: return SDL_SCANCODE_SPACE;
+            case InputKey::F2: return SDL_SCANCODE_F2;
+            default: return SDL_SCANCODE_UNKNOWN;
+        }
+    }
+    
+    // Returns false for scancodes the simulation does not track
+    static bool fromScancode(SDL_Scancode scancode, InputKey& out) {
+        for (Uint8 i = 0; i < static_cast<Uint8>(InputKey::Count); ++i) {
+            if (toScancode(static_cast<InputKey>(i)) == scancode) {
+                out = static_cast<InputKey>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    // Reads the live SDL keyboard/mouse state (call on the thread that pumps events)
+    static InputState sample() {
+        InputState state;
+        state.mouseButtons = SDL_GetMouseState(&state.mouseX, &state.mouseY);
+        const Uint8* keyStates = SDL_GetKeyboardState(nullptr);
+        for (Uint8 i = 0; i < static_cast<Uint8>(InputKey::Count); ++i) {
+            if (keyStates[toScancode(static_cast<InputKey>(i))]) {
+                state.keys |= keyBit(static_cast<InputKey>(i));
+            }
+        }
+        return state;
+    }
+};
@@ -0,0 +1,209 @@
+#include "JobSystem.h"
+#include <algorithm>
+
+namespace {
+    // Index of the worker running on this thread; -1 for main/simulation threads
+    thread_local int currentWorker = -1;
+}
+
+int JobSystem::getCurrentWorkerIndex() {
+    return currentWorker;
+}
+
+void JobSystem::start(int workerCount) {
+    if (!threads.empty()) return;
+
+    if (workerCount < 0) {
+        unsigned hardware = std::thread::hardware_concurrency();
+        workerCount = hardware > 2 ? static_cast<int>(hardware) - 2 : 1;
+    }
+
+    stopping = false;
+    workers.reserve(workerCount);
+    for (int i = 0; i < workerCount; ++i) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+    for (int i = 0; i < workerCount; ++i) {
+        threads.emplace_back(&JobSystem::workerLoop, this, i);
+    }
+}
+
+void JobSystem::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wakeCondition.notify_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    threads.clear();
+
+    // Anything still queued runs here so waiters and dependents are not stranded
+    while (runOne()) {}
+    workers.clear();
+    queuedJobs = 0;
+}
+
+JobHandle JobSystem::schedule(std::function<void()> work, std::initializer_list<JobHandle> dependencies) {
+    auto job = std::make_shared<Job>();
+    job->work = std::move(work);
+    return submit(std::move(job), dependencies.begin(), dependencies.size());
+}
+
+JobHandle JobSystem::schedule(std::function<void()> work, const std::vector<JobHandle>& dependencies) {
+    auto job = std::make_shared<Job>();
+    job->work = std::move(work);
+    return submit(std::move(job), dependencies.data(), dependencies.size());
+}
+
+JobHandle JobSystem::submit(JobHandle job, const JobHandle* dependencies, size_t dependencyCount) {
+    for (size_t i = 0; i < dependencyCount; ++i) {
+        const JobHandle& dependency = dependencies[i];
+        if (!dependency) continue;
+        std::lock_guard<std::mutex> lock(dependency->dependentsMutex);
+        if (!dependency->finished.load(std::memory_order_acquire)) {
+            dependency->dependents.push_back(job);
+            job->pendingDependencies.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    // Drop the hold taken at construction; queue now if nothing is outstanding
+    if (job->pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        enqueue(job);
+    }
+    return job;
+}
+
+void JobSystem::enqueue(JobHandle job) {
+    if (workers.empty()) {
+        execute(job);
+        return;
+    }
+
+    size_t target = currentWorker >= 0
+        ? static_cast<size_t>(currentWorker)
+        : nextExternalQueue.fetch_add(1, std::memory_order_relaxed) % workers.size();
+    {
+        std::lock_guard<std::mutex> lock(workers[target]->mutex);
+        workers[target]->jobs.push_back(std::move(job));
+    }
+    queuedJobs.fetch_add(1, std::memory_order_release);
+    {
+        // Pairs with the predicate check in workerLoop so the wake is not lost
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    wakeCondition.notify_one();
+}
+
+void JobSystem::execute(const JobHandle& job) {
+    job->work();
+    job->work = nullptr;  // release captures now rather than when the last handle goes
+
+    std::vector<JobHandle> ready;
+    {
+        std::lock_guard<std::mutex> lock(job->dependentsMutex);
+        job->finished.store(true, std::memory_order_release);
+        ready.swap(job->dependents);
+    }
+    for (auto& dependent : ready) {
+        if (dependent->pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            enqueue(std::move(dependent));
+        }
+    }
+}
+
+JobHandle JobSystem::popOrSteal() {
+    if (workers.empty() || queuedJobs.load(std::memory_order_acquire) == 0) {
+        return nullptr;
+    }
+
+    const size_t count = workers.size();
+    size_t start = 0;
+    if (currentWorker >= 0) {
+        // Own deque first, newest job
+        Worker& own = *workers[currentWorker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.jobs.empty()) {
+            JobHandle job = std::move(own.jobs.back());
+            own.jobs.pop_back();
+            queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+        start = static_cast<size_t>(currentWorker) + 1;
+    }
+
+    // Steal the oldest job from someone else
+    for (size_t i = 0; i < count; ++i) {
+        Worker& victim = *workers[(start + i) % count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.jobs.empty()) {
+            JobHandle job = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+            queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+bool JobSystem::runOne() {
+    JobHandle job = popOrSteal();
+    if (!job) return false;
+    execute(job);
+    return true;
+}
+
+void JobSystem::workerLoop(int index) {
+    currentWorker = index;
+    while (!stopping.load(std::memory_order_acquire)) {
+        if (runOne()) continue;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wakeCondition.wait(lock, [this] {
+            return stopping.load(std::memory_order_acquire) || queuedJobs.load(std::memory_order_acquire) > 0;
+        });
+    }
+    currentWorker = -1;
+}
+
+void JobSystem::wait(const JobHandle& job) {
+    if (!job) return;
+    while (!job->finished.load(std::memory_order_acquire)) {
+        if (!runOne()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::waitAll(const std::vector<JobHandle>& jobs) {
+    for (const auto& job : jobs) {
+        wait(job);
+    }
+}
+
+void JobSystem::parallelFor(size_t count, size_t minChunk, const std::function<void(size_t, size_t)>& body) {
+    if (count == 0) return;
+    minChunk = std::max<size_t>(minChunk, 1);
+
+    // A few chunks per thread so stealing can even out uneven work
+    const size_t threadCount = workers.size() + 1;
+    size_t chunkCount = std::min((count + minChunk - 1) / minChunk, threadCount * 4);
+    if (workers.empty() || chunkCount <= 1) {
+        body(0, count);
+        return;
+    }
+
+    const size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+    chunkCount = (count + chunkSize - 1) / chunkSize;
+
+    std::vector<JobHandle> jobs;
+    jobs.reserve(chunkCount - 1);
+    for (size_t chunk = 1; chunk < chunkCount; ++chunk) {
+        size_t begin = chunk * chunkSize;
+        size_t end = std::min(begin + chunkSize, count);
+        jobs.push_back(schedule([&body, begin, end] { body(begin, end); }));
+    }
+    // The caller takes the first chunk itself, then helps with the rest
+    body(0, std::min(chunkSize, count));
+    waitAll(jobs);
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A scheduled unit of work. Jobs may depend on other jobs; a job is only
+// queued once every dependency has finished.
+struct Job {
+    std::function<void()> work;
+    std::atomic<int> pendingDependencies{1};  // +1 held until schedule() has linked everything
+    std::atomic<bool> finished{false};
+    std::mutex dependentsMutex;               // guards dependents and the finished transition
+    std::vector<std::shared_ptr<Job>> dependents;
+};
+
+using JobHandle = std::shared_ptr<Job>;
+
+// Work-stealing thread pool. Each worker owns a deque: it pushes and pops
+// its own jobs at the back (most recent first, still warm in cache) and,
+// when empty, steals the oldest job from the front of another worker's deque.
+// Threads that are not workers (main, simulation) push round-robin and help
+// run jobs while they wait, so a wait never idles a core.
+//
+// With zero workers every job runs inline on the calling thread.
+class JobSystem {
+public:
+    static JobSystem& getInstance() {
+        static JobSystem instance;
+        return instance;
+    }
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // Start the pool. workerCount < 0 picks one per hardware thread, minus
+    // the main and simulation threads; 0 runs everything inline.
+    void start(int workerCount);
+    void shutdown();
+
+    int getWorkerCount() const { return static_cast<int>(workers.size()); }
+
+    // Index of the pool worker running the caller, or -1 on any other thread
+    static int getCurrentWorkerIndex();
+
+    // Queue work to run once all dependencies have finished
+    JobHandle schedule(std::function<void()> work, std::initializer_list<JobHandle> dependencies = {});
+    JobHandle schedule(std::function<void()> work, const std::vector<JobHandle>& dependencies);
+
+    // Block until the job has finished, running other jobs meanwhile
+    void wait(const JobHandle& job);
+    void waitAll(const std::vector<JobHandle>& jobs);
+
+    // Split [0, count) into chunks of at least minChunk and run body(begin, end)
+    // on each across the pool; returns when every chunk is done. Small ranges
+    // run inline.
+    void parallelFor(size_t count, size_t minChunk, const std::function<void(size_t, size_t)>& body);
+
+private:
+    JobSystem() = default;
+    ~JobSystem() { shutdown(); }
+
+    struct Worker {
+        std::mutex mutex;
+        std::deque<JobHandle> jobs;
+    };
+
+    void workerLoop(int index);
+    void enqueue(JobHandle job);
+    void execute(const JobHandle& job);
+    bool runOne();                  // pop or steal one job and run it; false if none found
+    JobHandle popOrSteal();
+    JobHandle submit(JobHandle job, const JobHandle* dependencies, size_t dependencyCount);
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+    std::atomic<bool> stopping{false};
+    std::atomic<int> queuedJobs{0};
+    std::atomic<unsigned> nextExternalQueue{0};
+
+    // Idle workers sleep here instead of spinning
+    std::mutex sleepMutex;
+    std::condition_variable wakeCondition;
+};
@@ -1,8 +1,9 @@
 #pragma once
 #include "Component.h"
+#include "ObjectPool.h"
 
 // Simple lifetime component that marks the owner for deletion after a duration
-class LifetimeComponent : public Component {
+class LifetimeComponent : public Component, public Pooled<LifetimeComponent> {
 public:
     LifetimeComponent() = default;
     explicit LifetimeComponent(float seconds) : remaining(seconds) {}
@@ -11,6 +12,8 @@ public:
 
     void update(float deltaTime) override;
 
+    UpdatePhase getUpdatePhase() const override { return UpdatePhase::Gameplay; }
+
 private:
     float remaining = 1.0f; // seconds
 };
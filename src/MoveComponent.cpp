@@ -18,19 +18,16 @@ void MoveComponent::update(float dt) {
     if (!transform || !physicsBody || !physicsBody->isInitialized()) return;
     
     // Debug: F2 toggles spawn/despawn of an asteroid ~50px to the left of player
-    const Uint8* keyStates = SDL_GetKeyboardState(nullptr);
-    bool isF2Down = keyStates[SDL_SCANCODE_F2];
-    if (isF2Down && !wasF2Down) { // Key just pressed
-        if (debugAsteroid == nullptr) {
+    if (input && input->isKeyPressed(SDL_SCANCODE_F2)) {
+        if (!Engine::getInstance().isAlive(debugAsteroid)) {
             float ax = transform->getX() - 150.0f;
             float ay = transform->getY();
             debugAsteroid = Engine::getInstance().spawnAsteroid(ax, ay, 85.0f);
         } else {
             Engine::getInstance().removeGameObject(debugAsteroid);
-            debugAsteroid = nullptr;
+            debugAsteroid = GameObjectHandle();
         }
     }
-    wasF2Down = isF2Down;
 
     b2BodyId bodyId = physicsBody->getBodyId();
 
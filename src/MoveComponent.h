@@ -1,5 +1,6 @@
 #pragma once
 #include "Component.h"
+#include "GameObjectHandle.h"
 
 class TransformComponent;
 class PhysicsBodyComponent;
@@ -16,6 +17,7 @@ public:
 
     void init() override;
     void update(float dt) override;
+    UpdatePhase getUpdatePhase() const override { return UpdatePhase::Gameplay; }
 
     void setMoveSpeed(float speed) { moveSpeed = speed; } // legacy (interpreted as maxSpeed if provided)
     void setThrustForce(float force) { thrustForce = force; }
@@ -29,8 +31,7 @@ private:
     float arrivalRadius = 5.0f;     // stop moving when closer than this distance
     
     // Debug spawn
-    class GameObject* debugAsteroid = nullptr;
-    bool wasF2Down = false;
+    GameObjectHandle debugAsteroid;  // stale once the asteroid is culled or destroyed
 
     TransformComponent* transform = nullptr;
     PhysicsBodyComponent* physicsBody = nullptr;
@@ -0,0 +1,90 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <vector>
+
+// Free-list allocator for one object type. Memory is taken from the heap in
+// blocks of BlockSize objects and never handed back; freed slots are reused
+// most-recently-freed first. Once a game has reached its peak object count,
+// spawning and despawning no longer touch the heap.
+//
+// Not thread-safe: objects are created and destroyed on the simulation thread.
+template<typename T, std::size_t BlockSize = 64>
+class ObjectPool {
+public:
+    static ObjectPool& getInstance() {
+        // Never destroyed: objects owned by other singletons may be freed during exit
+        static ObjectPool* instance = new ObjectPool();
+        return *instance;
+    }
+    
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+    
+    void* allocate() {
+        if (freeList) {
+            Slot* slot = freeList;
+            freeList = slot->next;
+            ++hits;
+            ++live;
+            return slot;
+        }
+        
+        ++misses;
+        if (nextUnused == BlockSize || blocks.empty()) {
+            blocks.push_back(static_cast<Slot*>(::operator new(sizeof(Slot) * BlockSize)));
+            nextUnused = 0;
+        }
+        ++live;
+        return &blocks.back()[nextUnused++];
+    }
+    
+    void deallocate(void* p) {
+        Slot* slot = static_cast<Slot*>(p);
+        slot->next = freeList;
+        freeList = slot;
+        --live;
+    }
+    
+    // hits: reused a freed slot; misses: carved a new slot (a new block every BlockSize misses)
+    unsigned long long getHits() const { return hits; }
+    unsigned long long getMisses() const { return misses; }
+    std::size_t getLiveCount() const { return live; }
+    std::size_t getCapacity() const { return blocks.size() * BlockSize; }
+    
+private:
+    ObjectPool() = default;
+    
+    union Slot {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+    
+    std::vector<Slot*> blocks;
+    std::size_t nextUnused = 0;  // first untouched slot in blocks.back()
+    Slot* freeList = nullptr;
+    std::size_t live = 0;
+    unsigned long long hits = 0;
+    unsigned long long misses = 0;
+};
+
+// Mixin routing new/delete of T through ObjectPool<T>. Use on final classes:
+//     class SpriteComponent : public Component, public Pooled<SpriteComponent>
+// A class derived from T that is larger than T falls back to the global heap.
+template<typename T>
+class Pooled {
+public:
+    static void* operator new(std::size_t size) {
+        if (size != sizeof(T)) return ::operator new(size);
+        return ObjectPool<T>::getInstance().allocate();
+    }
+    
+    static void operator delete(void* p, std::size_t size) {
+        if (!p) return;
+        if (size != sizeof(T)) {
+            ::operator delete(p);
+            return;
+        }
+        ObjectPool<T>::getInstance().deallocate(p);
+    }
+};
@@ -1,5 +1,6 @@
 #pragma once
 #include "Component.h"
+#include "ObjectPool.h"
 #include <SDL.h>
 
 class TransformComponent;
@@ -9,13 +10,14 @@ enum class EmitterType {
     Burst        // One-time explosion
 };
 
-class ParticleEmitterComponent : public Component {
+class ParticleEmitterComponent : public Component, public Pooled<ParticleEmitterComponent> {
 public:
     ParticleEmitterComponent() = default;
     ~ParticleEmitterComponent() override = default;
     
     void init() override;
     void update(float deltaTime) override;
+    UpdatePhase getUpdatePhase() const override { return UpdatePhase::Late; }
     
     // Configuration
     void setEmitterType(EmitterType type) { emitterType = type; }
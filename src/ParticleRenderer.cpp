@@ -0,0 +1,104 @@
+#include "ParticleRenderer.h"
+#include "RenderSnapshot.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+ParticleRenderer::ParticleRenderer(SDL_Renderer* renderer) : renderer(renderer) {
+    createSoftTexture();
+}
+
+ParticleRenderer::~ParticleRenderer() {
+    if (softTexture) {
+        SDL_DestroyTexture(softTexture);
+    }
+}
+
+void ParticleRenderer::createSoftTexture() {
+    if (!renderer) return;
+
+    // White disc whose alpha falls off smoothly to the edge; vertex colors tint it
+    const int size = 32;
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, size, size, 32, SDL_PIXELFORMAT_RGBA32);
+    if (!surface) {
+        std::cerr << "ParticleRenderer: could not create soft particle surface: " << SDL_GetError() << std::endl;
+        return;
+    }
+    const float radius = size * 0.5f;
+    for (int y = 0; y < size; ++y) {
+        Uint8* row = static_cast<Uint8*>(surface->pixels) + y * surface->pitch;
+        for (int x = 0; x < size; ++x) {
+            float dx = (x + 0.5f - radius) / radius;
+            float dy = (y + 0.5f - radius) / radius;
+            float t = std::max(0.0f, 1.0f - std::sqrt(dx * dx + dy * dy));
+            float falloff = t * t * (3.0f - 2.0f * t);  // smoothstep
+            Uint8* pixel = row + x * 4;
+            pixel[0] = 255;
+            pixel[1] = 255;
+            pixel[2] = 255;
+            pixel[3] = static_cast<Uint8>(falloff * 255.0f);
+        }
+    }
+    softTexture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_FreeSurface(surface);
+    if (softTexture) {
+        SDL_SetTextureBlendMode(softTexture, SDL_BLENDMODE_BLEND);
+    }
+}
+
+void ParticleRenderer::ensureIndices(size_t quadCount) {
+    // The pattern never changes, so only the tail past the previous peak is written
+    size_t quads = indices.size() / 6;
+    if (quads >= quadCount) return;
+    indices.reserve(quadCount * 6);
+    for (; quads < quadCount; ++quads) {
+        const int base = static_cast<int>(quads * 4);
+        indices.push_back(base);
+        indices.push_back(base + 1);
+        indices.push_back(base + 2);
+        indices.push_back(base);
+        indices.push_back(base + 2);
+        indices.push_back(base + 3);
+    }
+}
+
+void ParticleRenderer::render(const std::vector<ParticleInstance>& instances, const RenderView& view,
+                              float alpha, CullStats& cull) {
+    if (!renderer) return;
+
+    const WorldBounds visible = view.getVisibleBounds();
+    SDL_Texture* texture = useSoftTexture ? softTexture : nullptr;
+
+    vertices.clear();
+    for (const ParticleInstance& p : instances) {
+        float x = lerpValue(p.prevX, p.x, alpha);
+        float y = lerpValue(p.prevY, p.y, alpha);
+        if (!visible.overlaps(x, y, p.size)) {
+            ++cull.culled;
+            continue;
+        }
+        ++cull.drawn;
+
+        // Screen-space corners of the particle's square, clockwise from top-left
+        SDL_FRect screenRect = view.worldToScreen({x - p.size, y - p.size, p.size * 2, p.size * 2});
+        const float left = screenRect.x;
+        const float top = screenRect.y;
+        const float right = screenRect.x + screenRect.w;
+        const float bottom = screenRect.y + screenRect.h;
+        vertices.push_back({{left, top}, p.color, {0.0f, 0.0f}});
+        vertices.push_back({{right, top}, p.color, {1.0f, 0.0f}});
+        vertices.push_back({{right, bottom}, p.color, {1.0f, 1.0f}});
+        vertices.push_back({{left, bottom}, p.color, {0.0f, 1.0f}});
+    }
+    if (vertices.empty()) return;
+
+    const size_t quadCount = vertices.size() / 4;
+    ensureIndices(quadCount);
+
+    // Untextured geometry blends with the draw blend mode
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_RenderGeometry(renderer, texture,
+                       vertices.data(), static_cast<int>(vertices.size()),
+                       indices.data(), static_cast<int>(quadCount * 6));
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+}
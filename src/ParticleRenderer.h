@@ -0,0 +1,38 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <vector>
+
+struct ParticleInstance;
+struct RenderView;
+struct CullStats;
+
+// Draws every visible particle with one SDL_RenderGeometry call. Each particle
+// is a quad written into a vertex array that is reused frame to frame; the
+// index buffer only grows when the particle count exceeds its previous peak.
+// Quads are either flat-colored or textured with a generated soft-circle
+// sprite tinted by the vertex color.
+class ParticleRenderer {
+public:
+    explicit ParticleRenderer(SDL_Renderer* renderer);
+    ~ParticleRenderer();
+
+    ParticleRenderer(const ParticleRenderer&) = delete;
+    ParticleRenderer& operator=(const ParticleRenderer&) = delete;
+
+    // Blend snapshot particles between the last two fixed steps by alpha (0..1).
+    // Particles outside the view are skipped and counted in cull.
+    void render(const std::vector<ParticleInstance>& instances, const RenderView& view, float alpha, CullStats& cull);
+
+    // Soft round particles (default) or flat squares
+    void setSoftTexture(bool enabled) { useSoftTexture = enabled; }
+
+private:
+    void createSoftTexture();
+    void ensureIndices(size_t quadCount);
+
+    SDL_Renderer* renderer = nullptr;
+    SDL_Texture* softTexture = nullptr;
+    bool useSoftTexture = true;
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+};
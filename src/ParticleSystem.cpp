@@ -1,10 +1,14 @@
 #include "ParticleSystem.h"
-#include "View.h"
+#include "RenderSnapshot.h"
+#include "JobSystem.h"
 #include <cmath>
 #include <algorithm>
 
 void ParticleSystem::spawn(const Particle& particle) {
     particles.push_back(particle);
+    // New particles have no history yet; don't streak from the origin
+    particles.back().prevX = particle.x;
+    particles.back().prevY = particle.y;
 }
 
 void ParticleSystem::spawnBurst(float x, float y, int count, 
@@ -16,6 +20,8 @@ void ParticleSystem::spawnBurst(float x, float y, int count,
         Particle p;
         p.x = x;
         p.y = y;
+        p.prevX = x;
+        p.prevY = y;
         
         // Random angle and speed
         float angle = (static_cast<float>(rand()) / RAND_MAX) * 2.0f * PI;
@@ -34,12 +40,15 @@ void ParticleSystem::spawnBurst(float x, float y, int count,
 }
 
 void ParticleSystem::update(float deltaTime) {
-    // Update all particles and remove dead ones
-    for (auto& p : particles) {
-        p.age += deltaTime;
-        p.x += p.vx * deltaTime;
-        p.y += p.vy * deltaTime;
-    }
+    // Particles are independent, so integration fans out over the job system
+    JobSystem::getInstance().parallelFor(particles.size(), 4096, [this, deltaTime](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            Particle& p = particles[i];
+            p.age += deltaTime;
+            p.x += p.vx * deltaTime;
+            p.y += p.vy * deltaTime;
+        }
+    });
     
     // Remove dead particles (erase-remove idiom)
     particles.erase(
@@ -49,34 +58,25 @@ void ParticleSystem::update(float deltaTime) {
     );
 }
 
-void ParticleSystem::render(SDL_Renderer* renderer, View* view) {
-    if (!renderer || !view) return;
-    
-    // Enable alpha blending for particle transparency
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-    
+void ParticleSystem::storePrevious() {
+    for (auto& p : particles) {
+        p.prevX = p.x;
+        p.prevY = p.y;
+    }
+}
+
+void ParticleSystem::snapshot(std::vector<ParticleInstance>& out) const {
+    out.reserve(particles.size());
     for (const auto& p : particles) {
-        // Create a world rect for the particle
-        SDL_Rect worldRect = {
-            static_cast<int>(p.x - p.size),
-            static_cast<int>(p.y - p.size),
-            static_cast<int>(p.size * 2),
-            static_cast<int>(p.size * 2)
-        };
-        
-        // Transform to screen coordinates
-        SDL_Rect screenRect = view->worldToScreen(worldRect);
-        
-        // Get current color with fade
-        SDL_Color color = p.getCurrentColor();
-        SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
-        
-        // Draw particle as a filled rect
-        SDL_RenderFillRect(renderer, &screenRect);
+        ParticleInstance instance;
+        instance.prevX = p.prevX;
+        instance.prevY = p.prevY;
+        instance.x = p.x;
+        instance.y = p.y;
+        instance.size = p.size;
+        instance.color = p.getCurrentColor();
+        out.push_back(instance);
     }
-    
-    // Reset blend mode
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
 }
 
 void ParticleSystem::clear() {
@@ -2,10 +2,14 @@
 #include <SDL.h>
 #include <vector>
 
+struct ParticleInstance;
+
 // Lightweight particle struct (not a GameObject)
 struct Particle {
     float x = 0.0f;
     float y = 0.0f;
+    float prevX = 0.0f;  // position at the start of the current fixed step
+    float prevY = 0.0f;
     float vx = 0.0f;  // velocity x
     float vy = 0.0f;  // velocity y
     float lifetime = 1.0f;      // total lifetime in seconds
@@ -53,8 +57,11 @@ public:
     // Update all particles (remove dead ones)
     void update(float deltaTime);
     
-    // Render all particles
-    void render(SDL_Renderer* renderer, class View* view);
+    // Remember positions at the start of a fixed step for render interpolation
+    void storePrevious();
+    
+    // Copy live particles (with their current color) for the renderer
+    void snapshot(std::vector<ParticleInstance>& out) const;
     
     // Clear all particles
     void clear();
@@ -1,5 +1,7 @@
 ﻿#pragma once
 #include "Component.h"
+#include "ObjectPool.h"
+#include "CollisionLayers.h"
 #include <box2d/box2d.h>
 
 class TransformComponent;
@@ -16,15 +18,22 @@ enum class ShapeType {
     Ellipse  // Approximated with polygon
 };
 
-class PhysicsBodyComponent : public Component {
+// Holds body configuration; Engine::commitPendingBodies creates the Box2D body in
+// a batch once the object has been added. Requires a TransformComponent added
+// before it; the transform is written back by ComponentStore::syncFromMoveEvents
+// whenever Box2D reports the body moved.
+class PhysicsBodyComponent : public Component, public Pooled<PhysicsBodyComponent> {
 public:
     PhysicsBodyComponent() = default;
     ~PhysicsBodyComponent();
     
     void init() override;
-    void update(float deltaTime) override;
     
-    // Configuration (call before init)
+    // Creates the body and its shape from the current configuration. Returns
+    // false if it already exists or cannot be created.
+    bool createBody(b2WorldId worldId);
+    
+    // Configuration (call before the body is created)
     void setBodyType(BodyType type) { bodyType = type; }
     void setShapeType(ShapeType shape) { shapeType = shape; }
     void setDensity(float d) { density = d; }
@@ -36,8 +45,10 @@ public:
     void setCollisionScaleX(float sx) { collisionScaleX = sx; }
     void setCollisionScaleY(float sy) { collisionScaleY = sy; }
     void setCollisionScale(float sx, float sy) { collisionScaleX = sx; collisionScaleY = sy; }
+    void setCollisionLayer(CollisionLayerId layer) { collisionLayer = layer; }
     
-    // Runtime access
+    // Runtime access (the body ID is mirrored into the owner's ComponentStore row
+    // so PhysicsDebugDraw can walk bodies without visiting components)
     b2BodyId getBodyId() const { return bodyId; }
     bool isInitialized() const { return b2Body_IsValid(bodyId); }
     BodyType getBodyType() const { return bodyType; }
@@ -62,4 +73,5 @@ private:
     bool fixedRotation = false;
     float collisionScaleX = 1.0f;
     float collisionScaleY = 1.0f;
+    CollisionLayerId collisionLayer = CollisionLayers::Default;
 };
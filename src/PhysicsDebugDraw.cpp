@@ -1,63 +1,84 @@
 #include "PhysicsDebugDraw.h"
-#include "GameObject.h"
-#include "TransformComponent.h"
-#include "SpriteComponent.h"
-#include "PhysicsBodyComponent.h"
+#include "ComponentStore.h"
+#include "RenderSnapshot.h"
 #include <SDL2/SDL.h>
 #include <cmath>
 #include <iostream>
-#include "View.h"
-#include "Engine.h"
 
-bool PhysicsDebugDraw::enabled = false;
+std::atomic<bool> PhysicsDebugDraw::enabled{false};
 
 void PhysicsDebugDraw::toggle() { enabled = !enabled; std::cout << "Physics debug draw " << (enabled ? "ENABLED" : "DISABLED") << std::endl; }
 void PhysicsDebugDraw::setEnabled(bool e) { enabled = e; }
 bool PhysicsDebugDraw::isEnabled() { return enabled; }
 
-void PhysicsDebugDraw::render(SDL_Renderer* renderer, const std::vector<std::unique_ptr<GameObject>>& objects) {
+void PhysicsDebugDraw::snapshot(std::vector<DebugBodyInstance>& out) {
+    if (!enabled) return;
+    
+    const ComponentStore& store = ComponentStore::getInstance();
+    for (size_t i = 0; i < store.size(); ++i) {
+        if (B2_IS_NULL(store.bodyId[i])) continue;
+        
+        DebugBodyInstance body;
+        body.x = store.x[i];
+        body.y = store.y[i];
+        body.rotation = store.rotation[i];
+        body.prevX = store.hasPrevious[i] ? store.prevX[i] : body.x;
+        body.prevY = store.hasPrevious[i] ? store.prevY[i] : body.y;
+        body.prevRotation = store.hasPrevious[i] ? store.prevRotation[i] : body.rotation;
+        body.bodyType = store.bodyType[i];
+        body.shapeType = store.shapeType[i];
+        
+        // Dimensions from sprite (fallback 50x50)
+        body.width = store.hasSprite[i] ? store.width[i] : 50.0f;
+        body.height = store.hasSprite[i] ? store.height[i] : 50.0f;
+        
+        if (body.bodyType == BodyType::Dynamic) {
+            b2Vec2 vel = b2Body_GetLinearVelocity(store.bodyId[i]);
+            body.velocityX = vel.x * PhysicsBodyComponent::PIXELS_PER_METER;
+            body.velocityY = vel.y * PhysicsBodyComponent::PIXELS_PER_METER;
+        }
+        out.push_back(body);
+    }
+}
+
+void PhysicsDebugDraw::render(SDL_Renderer* renderer, const std::vector<DebugBodyInstance>& bodies, const RenderView& view, float alpha, CullStats& cull) {
     if (!enabled) return;
     if (!renderer) return;
 
+    const WorldBounds visible = view.getVisibleBounds();
+
     SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-    int bodyCount = 0;
-    for (const auto& obj : objects) {
-        auto* phys = obj->getComponent<PhysicsBodyComponent>();
-        if (!phys || !phys->isInitialized()) continue;
-        auto* transform = obj->getComponent<TransformComponent>();
-        auto* sprite = obj->getComponent<SpriteComponent>();
-        if (!transform) continue;
-        ++bodyCount;
+    for (const DebugBodyInstance& body : bodies) {
+        // World position (interpolated like sprites so the overlay stays aligned)
+        SDL_FRect point{lerpValue(body.prevX, body.x, alpha), lerpValue(body.prevY, body.y, alpha), 0.0f, 0.0f};
+
+        // Outline fits within half the diagonal at any rotation
+        float halfExtent = 0.5f * std::sqrt(body.width * body.width + body.height * body.height);
+        if (!visible.overlaps(point.x, point.y, halfExtent)) {
+            ++cull.culled;
+            continue;
+        }
+        ++cull.drawn;
 
-        // World position
-        float worldX = transform->getX();
-        float worldY = transform->getY();
-        // Reuse View::worldToScreen for consistency via a dummy rect
-        SDL_Rect dummy{(int)worldX, (int)worldY, 0, 0};
-        SDL_Rect screenPt = View::getInstance().worldToScreen(dummy);
-        float x = (float)screenPt.x;
-        float y = (float)screenPt.y;
-        float angleDeg = transform->getRotation();
+        SDL_FRect screenPt = view.worldToScreen(point);
+        float x = screenPt.x;
+        float y = screenPt.y;
+        float angleDeg = lerpRotation(body.prevRotation, body.rotation, alpha);
         float angleRad = angleDeg * 3.14159265f / 180.0f;
 
         // Choose color by body type
         Uint8 r=0,g=255,b=0,a=180; // dynamic default green
-        switch (phys->getBodyType()) {
+        switch (body.bodyType) {
             case BodyType::Static: r=160; g=160; b=160; a=200; break;
             case BodyType::Kinematic: r=0; g=128; b=255; a=200; break;
             case BodyType::Dynamic: default: r=0; g=255; b=0; a=200; break;
         }
         SDL_SetRenderDrawColor(renderer, r, g, b, a);
 
-        // Dimensions from sprite (fallback 50x50)
-        float width = 50.0f;
-        float height = 50.0f;
-        if (sprite) {
-            width = sprite->getWidth();
-            height = sprite->getHeight();
-        }
+        float width = body.width;
+        float height = body.height;
 
-        if (phys->getShapeType() == ShapeType::Circle) {
+        if (body.shapeType == ShapeType::Circle) {
             float radius = std::max(width, height) * 0.5f; // already in pixels
             const int segments = 24;
             for (int i = 0; i < segments; ++i) {
@@ -97,17 +118,15 @@ void PhysicsDebugDraw::render(SDL_Renderer* renderer, const std::vector<std::uni
         SDL_RenderDrawLine(renderer, (int)x, (int)y - 4, (int)x, (int)y + 4);
 
         // Optional: velocity vector (dynamic bodies only)
-        if (phys->getBodyType() == BodyType::Dynamic) {
-            b2BodyId bodyId = phys->getBodyId();
-            b2Vec2 vel = b2Body_GetLinearVelocity(bodyId);
+        if (body.bodyType == BodyType::Dynamic) {
             float scale = 35.0f; // length multiplier
-            int vx = (int)(x + vel.x * PhysicsBodyComponent::PIXELS_PER_METER * (scale * 0.016f));
-            int vy = (int)(y + vel.y * PhysicsBodyComponent::PIXELS_PER_METER * (scale * 0.016f));
+            int vx = (int)(x + body.velocityX * (scale * 0.016f));
+            int vy = (int)(y + body.velocityY * (scale * 0.016f));
             SDL_SetRenderDrawColor(renderer, 255, 255, 0, 200);
             SDL_RenderDrawLine(renderer, (int)x, (int)y, vx, vy);
         }
     }
-    if (bodyCount == 0) {
+    if (bodies.empty()) {
         // Helpful one-time message when enabled but no bodies found
         static bool warned = false;
         if (!warned) { std::cout << "Physics debug draw: no bodies found to render" << std::endl; warned = true; }
@@ -1,9 +1,11 @@
 #pragma once
+#include <atomic>
 #include <vector>
-#include <memory>
 
-class GameObject;
 struct SDL_Renderer;
+struct DebugBodyInstance;
+struct RenderView;
+struct CullStats;
 
 class PhysicsDebugDraw {
 public:
@@ -11,8 +13,12 @@ public:
     static void setEnabled(bool enabled);
     static bool isEnabled();
 
-    static void render(SDL_Renderer* renderer, const std::vector<std::unique_ptr<GameObject>>& objects);
+    // Simulation side: capture body outlines (only while enabled)
+    static void snapshot(std::vector<DebugBodyInstance>& out);
+    
+    // Render side: draw captured outlines, blended between steps by alpha
+    static void render(SDL_Renderer* renderer, const std::vector<DebugBodyInstance>& bodies, const RenderView& view, float alpha, CullStats& cull);
 
 private:
-    static bool enabled;
+    static std::atomic<bool> enabled;  // toggled by the event thread, read by the simulation
 };
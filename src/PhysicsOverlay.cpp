@@ -0,0 +1,60 @@
+#include "PhysicsOverlay.h"
+#include <algorithm>
+
+PhysicsOverlay::PhysicsOverlay(SDL_Renderer* renderer, const std::string& fontPath, int fontSize, int windowWidth)
+    : renderer(renderer), windowWidth(windowWidth) {
+    font = TTF_OpenFont(fontPath.c_str(), fontSize);
+}
+
+PhysicsOverlay::~PhysicsOverlay() {
+    for (auto& line : cache) {
+        if (line.texture) SDL_DestroyTexture(line.texture);
+    }
+    if (font) TTF_CloseFont(font);
+}
+
+void PhysicsOverlay::render(const std::vector<std::string>& lines) {
+    if (!font || !renderer || lines.empty()) return;
+    
+    if (cache.size() < lines.size()) cache.resize(lines.size());
+    int panelWidth = 0;
+    int panelHeight = 0;
+    for (size_t i = 0; i < lines.size(); ++i) {
+        Line& line = cache[i];
+        if (line.text != lines[i] || !line.texture) {
+            line.text = lines[i];
+            if (line.texture) {
+                SDL_DestroyTexture(line.texture);
+                line.texture = nullptr;
+            }
+            SDL_Color color = {200, 255, 200, 255};
+            if (SDL_Surface* surface = TTF_RenderText_Blended(font, line.text.c_str(), color)) {
+                line.texture = SDL_CreateTextureFromSurface(renderer, surface);
+                line.width = surface->w;
+                line.height = surface->h;
+                SDL_FreeSurface(surface);
+            }
+        }
+        panelWidth = std::max(panelWidth, line.width);
+        panelHeight += line.height;
+    }
+    
+    const int margin = 10;
+    const int padding = 6;
+    SDL_Rect panel = {windowWidth - panelWidth - margin - 2 * padding, margin,
+                      panelWidth + 2 * padding, panelHeight + 2 * padding};
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 170);
+    SDL_RenderFillRect(renderer, &panel);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    
+    int y = panel.y + padding;
+    for (size_t i = 0; i < lines.size(); ++i) {
+        const Line& line = cache[i];
+        if (line.texture) {
+            SDL_Rect dest = {panel.x + padding, y, line.width, line.height};
+            SDL_RenderCopy(renderer, line.texture, nullptr, &dest);
+        }
+        y += line.height;
+    }
+}
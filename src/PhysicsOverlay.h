@@ -0,0 +1,31 @@
+#pragma once
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <string>
+#include <vector>
+
+// Draws the physics profiler's text lines (RenderSnapshot::physicsOverlay) in
+// the top right corner. Line textures are only re-rendered when their text
+// changes, which the profiler limits to a few times per second.
+class PhysicsOverlay {
+public:
+    PhysicsOverlay(SDL_Renderer* renderer, const std::string& fontPath, int fontSize, int windowWidth);
+    ~PhysicsOverlay();
+    
+    PhysicsOverlay(const PhysicsOverlay&) = delete;
+    PhysicsOverlay& operator=(const PhysicsOverlay&) = delete;
+    
+    void render(const std::vector<std::string>& lines);
+    
+private:
+    struct Line {
+        std::string text;
+        SDL_Texture* texture = nullptr;
+        int width = 0, height = 0;
+    };
+    
+    SDL_Renderer* renderer;
+    TTF_Font* font = nullptr;
+    int windowWidth;
+    std::vector<Line> cache;
+};
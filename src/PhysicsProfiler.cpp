@@ -0,0 +1,238 @@
+#include "PhysicsProfiler.h"
+#include "ComponentStore.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+std::atomic<bool> PhysicsProfiler::overlayVisible{false};
+
+namespace {
+    // Samples between overlay text rebuilds (a quarter second at 60 Hz)
+    const unsigned OverlayRefreshSamples = 15;
+}
+
+PhysicsProfiler::PhysicsProfiler() {
+    setWindowSize(1024);
+}
+
+void PhysicsProfiler::setWindowSize(size_t samplesPerStat) {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    timings.assign(static_cast<size_t>(PhysicsTiming::Count), RollingStats(samplesPerStat));
+    counters.assign(static_cast<size_t>(PhysicsCounter::Count), RollingStats(samplesPerStat));
+}
+
+void PhysicsProfiler::sample(b2WorldId world) {
+    if (!isSampling() || !b2World_IsValid(world)) return;
+    
+    b2Profile profile = b2World_GetProfile(world);
+    b2Counters worldCounters = b2World_GetCounters(world);
+    
+    // Same order as PhysicsTiming
+    const float timingValues[] = {
+        profile.step, profile.pairs, profile.collide, profile.solve, profile.mergeIslands,
+        profile.prepareStages, profile.solveConstraints, profile.prepareConstraints,
+        profile.integrateVelocities, profile.warmStart, profile.solveImpulses,
+        profile.integratePositions, profile.relaxImpulses, profile.applyRestitution,
+        profile.storeImpulses, profile.splitIslands, profile.transforms, profile.hitEvents,
+        profile.refit, profile.bullets, profile.sleepIslands, profile.sensors,
+    };
+    static_assert(sizeof(timingValues) / sizeof(timingValues[0]) == static_cast<size_t>(PhysicsTiming::Count),
+                  "PhysicsTiming and b2Profile fields out of sync");
+    
+    if (samplesSinceTypeRefresh == 0) {
+        refreshTypeTotals();
+    }
+    samplesSinceTypeRefresh = (samplesSinceTypeRefresh + 1) % OverlayRefreshSamples;
+    
+    const int counterValues[] = {
+        worldCounters.bodyCount, worldCounters.shapeCount, worldCounters.contactCount,
+        worldCounters.jointCount, worldCounters.islandCount, worldCounters.taskCount,
+        worldCounters.stackUsed, worldCounters.treeHeight, worldCounters.staticTreeHeight,
+        worldCounters.byteCount,
+        typeBodies[0], typeBodies[1], typeBodies[2],
+        typeShapes[0], typeShapes[1], typeShapes[2],
+        typeContacts[0], typeContacts[1], typeContacts[2],
+    };
+    static_assert(sizeof(counterValues) / sizeof(counterValues[0]) == static_cast<size_t>(PhysicsCounter::Count),
+                  "PhysicsCounter and sampled values out of sync");
+    
+    std::lock_guard<std::mutex> lock(statsMutex);
+    for (size_t i = 0; i < timings.size(); ++i) {
+        timings[i].add(timingValues[i]);
+    }
+    for (size_t i = 0; i < counters.size(); ++i) {
+        counters[i].add(counterValues[i]);
+    }
+    ++samplesSinceFormat;
+}
+
+void PhysicsProfiler::refreshTypeTotals() {
+    for (int type = 0; type < 3; ++type) {
+        typeBodies[type] = 0;
+        typeShapes[type] = 0;
+        typeContacts[type] = 0;
+    }
+    
+    const ComponentStore& store = ComponentStore::getInstance();
+    for (size_t i = 0; i < store.size(); ++i) {
+        b2BodyId body = store.bodyId[i];
+        if (B2_IS_NULL(body)) continue;
+        int type = static_cast<int>(store.bodyType[i]);
+        ++typeBodies[type];
+        typeShapes[type] += b2Body_GetShapeCount(body);
+        
+        // Capacity includes broadphase pairs that are not touching; only touching ones are copied
+        int capacity = b2Body_GetContactCapacity(body);
+        if (capacity == 0) continue;
+        if (contactScratch.size() < static_cast<size_t>(capacity)) {
+            contactScratch.resize(capacity);
+        }
+        typeContacts[type] += b2Body_GetContactData(body, contactScratch.data(), capacity);
+    }
+}
+
+void PhysicsProfiler::formatOverlay(std::vector<std::string>& out) {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    if (overlayLines.empty() || samplesSinceFormat >= OverlayRefreshSamples) {
+        samplesSinceFormat = 0;
+        overlayLines.clear();
+        char line[128];
+        
+        std::snprintf(line, sizeof(line), "%-18s %7s %7s %7s", "box2d (ms)", "mean", "p95", "max");
+        overlayLines.emplace_back(line);
+        const PhysicsTiming shown[] = {
+            PhysicsTiming::Step, PhysicsTiming::Pairs, PhysicsTiming::Collide, PhysicsTiming::Solve,
+            PhysicsTiming::SolveConstraints, PhysicsTiming::Transforms, PhysicsTiming::Refit,
+            PhysicsTiming::SleepIslands,
+        };
+        for (PhysicsTiming t : shown) {
+            const RollingStats& s = timing(t);
+            std::snprintf(line, sizeof(line), "%-18s %7.3f %7.3f %7.3f", getTimingName(t),
+                          s.getMean(), s.getPercentile(95.0), s.getMax());
+            overlayLines.emplace_back(line);
+        }
+        
+        auto latest = [this](PhysicsCounter c) { return static_cast<int>(counter(c).getLatest()); };
+        std::snprintf(line, sizeof(line), "bodies %d  shapes %d  contacts %d  islands %d  tasks %d",
+                      latest(PhysicsCounter::Bodies), latest(PhysicsCounter::Shapes), latest(PhysicsCounter::Contacts),
+                      latest(PhysicsCounter::Islands), latest(PhysicsCounter::Tasks));
+        overlayLines.emplace_back(line);
+        std::snprintf(line, sizeof(line), "tree height %d (static %d)  memory %d KB  stack %d KB",
+                      latest(PhysicsCounter::TreeHeight), latest(PhysicsCounter::StaticTreeHeight),
+                      latest(PhysicsCounter::ByteCount) / 1024, latest(PhysicsCounter::StackUsed) / 1024);
+        overlayLines.emplace_back(line);
+        
+        const char* typeNames[] = {"static", "dynamic", "kinematic"};
+        for (int type = 0; type < 3; ++type) {
+            std::snprintf(line, sizeof(line), "%-9s bodies %d  shapes %d  contacts %d", typeNames[type],
+                          latest(static_cast<PhysicsCounter>(static_cast<int>(PhysicsCounter::StaticBodies) + type)),
+                          latest(static_cast<PhysicsCounter>(static_cast<int>(PhysicsCounter::StaticShapes) + type)),
+                          latest(static_cast<PhysicsCounter>(static_cast<int>(PhysicsCounter::StaticContacts) + type)));
+            overlayLines.emplace_back(line);
+        }
+    }
+    out = overlayLines;
+}
+
+void PhysicsProfiler::printSummary() const {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    if (timing(PhysicsTiming::Step).getTotalCount() == 0) return;
+    
+    std::printf("%-22s %10s %9s %9s %9s %9s %9s\n", "box2d (ms)", "samples", "mean", "p50", "p95", "p99", "max");
+    for (size_t i = 0; i < timings.size(); ++i) {
+        const RollingStats& s = timings[i];
+        std::printf("%-22s %10llu %9.3f %9.3f %9.3f %9.3f %9.3f\n", getTimingName(static_cast<PhysicsTiming>(i)),
+                    s.getTotalCount(), s.getMean(), s.getPercentile(50.0), s.getPercentile(95.0),
+                    s.getPercentile(99.0), s.getMax());
+    }
+    std::printf("%-22s %10s %9s %9s %9s\n", "box2d counters", "", "mean", "p95", "max");
+    for (size_t i = 0; i < counters.size(); ++i) {
+        const RollingStats& s = counters[i];
+        std::printf("%-22s %10s %9.1f %9.0f %9.0f\n", getCounterName(static_cast<PhysicsCounter>(i)), "",
+                    s.getMean(), s.getPercentile(95.0), s.getMax());
+    }
+    std::fflush(stdout);
+}
+
+bool PhysicsProfiler::appendCSV(const std::string& path) const {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    if (timing(PhysicsTiming::Step).getTotalCount() == 0) return true;
+    
+    std::ofstream file(path, std::ios::app);
+    if (!file) {
+        std::cerr << "PhysicsProfiler: could not open '" << path << "' for appending" << std::endl;
+        return false;
+    }
+    
+    // Same columns as the frame profiler; counter rows hold counts, not milliseconds
+    auto writeRow = [&file](const std::string& name, const RollingStats& s) {
+        file << name << ','
+             << s.getTotalCount() << ','
+             << s.getCount() << ','
+             << s.getMean() << ','
+             << s.getPercentile(50.0) << ','
+             << s.getPercentile(95.0) << ','
+             << s.getPercentile(99.0) << ','
+             << s.getMax() << '\n';
+    };
+    for (size_t i = 0; i < timings.size(); ++i) {
+        writeRow(std::string("b2_") + getTimingName(static_cast<PhysicsTiming>(i)), timings[i]);
+    }
+    for (size_t i = 0; i < counters.size(); ++i) {
+        writeRow(std::string("b2_count_") + getCounterName(static_cast<PhysicsCounter>(i)), counters[i]);
+    }
+    return true;
+}
+
+const char* PhysicsProfiler::getTimingName(PhysicsTiming timing) {
+    switch (timing) {
+        case PhysicsTiming::Step: return "step";
+        case PhysicsTiming::Pairs: return "pairs";
+        case PhysicsTiming::Collide: return "collide";
+        case PhysicsTiming::Solve: return "solve";
+        case PhysicsTiming::MergeIslands: return "merge_islands";
+        case PhysicsTiming::PrepareStages: return "prepare_stages";
+        case PhysicsTiming::SolveConstraints: return "solve_constraints";
+        case PhysicsTiming::PrepareConstraints: return "prepare_constraints";
+        case PhysicsTiming::IntegrateVelocities: return "integrate_velocities";
+        case PhysicsTiming::WarmStart: return "warm_start";
+        case PhysicsTiming::SolveImpulses: return "solve_impulses";
+        case PhysicsTiming::IntegratePositions: return "integrate_positions";
+        case PhysicsTiming::RelaxImpulses: return "relax_impulses";
+        case PhysicsTiming::ApplyRestitution: return "apply_restitution";
+        case PhysicsTiming::StoreImpulses: return "store_impulses";
+        case PhysicsTiming::SplitIslands: return "split_islands";
+        case PhysicsTiming::Transforms: return "transforms";
+        case PhysicsTiming::HitEvents: return "hit_events";
+        case PhysicsTiming::Refit: return "refit";
+        case PhysicsTiming::Bullets: return "bullets";
+        case PhysicsTiming::SleepIslands: return "sleep_islands";
+        case PhysicsTiming::Sensors: return "sensors";
+        default: return "unknown";
+    }
+}
+
+const char* PhysicsProfiler::getCounterName(PhysicsCounter counter) {
+    switch (counter) {
+        case PhysicsCounter::Bodies: return "bodies";
+        case PhysicsCounter::Shapes: return "shapes";
+        case PhysicsCounter::Contacts: return "contacts";
+        case PhysicsCounter::Joints: return "joints";
+        case PhysicsCounter::Islands: return "islands";
+        case PhysicsCounter::Tasks: return "tasks";
+        case PhysicsCounter::StackUsed: return "stack_bytes";
+        case PhysicsCounter::TreeHeight: return "tree_height";
+        case PhysicsCounter::StaticTreeHeight: return "static_tree_height";
+        case PhysicsCounter::ByteCount: return "bytes";
+        case PhysicsCounter::StaticBodies: return "static_bodies";
+        case PhysicsCounter::DynamicBodies: return "dynamic_bodies";
+        case PhysicsCounter::KinematicBodies: return "kinematic_bodies";
+        case PhysicsCounter::StaticShapes: return "static_shapes";
+        case PhysicsCounter::DynamicShapes: return "dynamic_shapes";
+        case PhysicsCounter::KinematicShapes: return "kinematic_shapes";
+        case PhysicsCounter::StaticContacts: return "static_contacts";
+        case PhysicsCounter::DynamicContacts: return "dynamic_contacts";
+        case PhysicsCounter::KinematicContacts: return "kinematic_contacts";
+        default: return "unknown";
+    }
+}
@@ -0,0 +1,116 @@
+#pragma once
+#include "FrameProfiler.h"
+#include <box2d/box2d.h>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Box2D's own step breakdown (b2World_GetProfile, milliseconds)
+enum class PhysicsTiming {
+    Step,                // whole b2World_Step
+    Pairs,               // broadphase pair finding
+    Collide,             // narrowphase
+    Solve,               // solver, all stages
+    MergeIslands,
+    PrepareStages,
+    SolveConstraints,
+    PrepareConstraints,
+    IntegrateVelocities,
+    WarmStart,
+    SolveImpulses,
+    IntegratePositions,
+    RelaxImpulses,
+    ApplyRestitution,
+    StoreImpulses,
+    SplitIslands,
+    Transforms,          // finalize bodies
+    HitEvents,
+    Refit,               // dynamic tree refit
+    Bullets,
+    SleepIslands,
+    Sensors,
+    Count
+};
+
+// World sizes (b2World_GetCounters) plus per-BodyType totals from the component store.
+// The per-type totals walk every body, so they are refreshed at the overlay's
+// rate (every few samples) and repeated in between.
+enum class PhysicsCounter {
+    Bodies,
+    Shapes,
+    Contacts,
+    Joints,
+    Islands,
+    Tasks,
+    StackUsed,         // bytes of solver stack
+    TreeHeight,        // dynamic tree
+    StaticTreeHeight,
+    ByteCount,         // bytes allocated by Box2D
+    StaticBodies,
+    DynamicBodies,
+    KinematicBodies,
+    StaticShapes,
+    DynamicShapes,
+    KinematicShapes,
+    StaticContacts,    // touching contacts on bodies of the type (a pair counts on both sides)
+    DynamicContacts,
+    KinematicContacts,
+    Count
+};
+
+// Samples Box2D's profile and counters after every step into the same rolling
+// statistics the frame profiler uses. Sampling runs while frame profiling is
+// enabled or the overlay (F5) is visible; otherwise it costs nothing.
+class PhysicsProfiler {
+public:
+    static PhysicsProfiler& getInstance() {
+        static PhysicsProfiler instance;
+        return instance;
+    }
+    
+    PhysicsProfiler(const PhysicsProfiler&) = delete;
+    PhysicsProfiler& operator=(const PhysicsProfiler&) = delete;
+    
+    static bool isSampling() { return FrameProfiler::isEnabled() || overlayVisible; }
+    static void toggleOverlay() { overlayVisible = !overlayVisible; }
+    static bool isOverlayVisible() { return overlayVisible; }
+    
+    void setWindowSize(size_t samplesPerStat);
+    
+    // Simulation side, right after b2World_Step
+    void sample(b2WorldId world);
+    
+    // Text for the overlay; rebuilt every few samples so the renderer is not
+    // re-rasterizing text every frame. Safe from the simulation thread.
+    void formatOverlay(std::vector<std::string>& out);
+    
+    // Log dump (F3 and exit) and CSV rows appended after the frame profiler's
+    void printSummary() const;
+    bool appendCSV(const std::string& path) const;
+    
+    static const char* getTimingName(PhysicsTiming timing);
+    static const char* getCounterName(PhysicsCounter counter);
+    
+private:
+    PhysicsProfiler();
+    
+    const RollingStats& timing(PhysicsTiming t) const { return timings[static_cast<size_t>(t)]; }
+    const RollingStats& counter(PhysicsCounter c) const { return counters[static_cast<size_t>(c)]; }
+    
+    static std::atomic<bool> overlayVisible;  // toggled by the event thread
+    std::vector<RollingStats> timings;
+    std::vector<RollingStats> counters;
+    std::vector<std::string> overlayLines;
+    unsigned samplesSinceFormat = 0;
+    
+    // Per BodyType (Static, Dynamic, Kinematic) totals; simulation thread only
+    void refreshTypeTotals();
+    int typeBodies[3] = {};
+    int typeShapes[3] = {};
+    int typeContacts[3] = {};
+    unsigned samplesSinceTypeRefresh = 0;
+    std::vector<b2ContactData> contactScratch;
+    mutable std::mutex statsMutex;  // F3 prints from the main thread
+};
@@ -0,0 +1,58 @@
+#include "PhysicsShapeCache.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Collision scale; zero or negative means unscaled
+    float effectiveScale(float scale) {
+        return scale > 0.0f ? scale : 1.0f;
+    }
+}
+
+std::uint64_t PhysicsShapeCache::bucket(float pixels) {
+    // Never 0: a zero radius or a collapsed hull would trip Box2D's asserts
+    long long rounded = std::llround(pixels);
+    return static_cast<std::uint64_t>(std::clamp(rounded, 1LL, 0xFFFFFFFFLL));
+}
+
+const b2Circle& PhysicsShapeCache::getCircle(float width, float height, float scaleX, float scaleY) {
+    // Apply uniform collision scaling (use min to keep circle)
+    std::uint64_t key = bucket(std::min(width, height) * effectiveScale(std::min(scaleX, scaleY)));
+    auto it = circles.find(key);
+    if (it != circles.end()) {
+        ++hits;
+        return it->second;
+    }
+    ++misses;
+    
+    // Built from the bucketed diameter so every body sharing the key gets the same shape
+    float radius = static_cast<float>(key) / 2.0f / PhysicsBodyComponent::PIXELS_PER_METER;
+    return circles.emplace(key, b2Circle{{0.0f, 0.0f}, radius}).first->second;
+}
+
+const b2Polygon& PhysicsShapeCache::getEllipse(float width, float height, float scaleX, float scaleY) {
+    std::uint64_t w = bucket(width * effectiveScale(scaleX));
+    std::uint64_t h = bucket(height * effectiveScale(scaleY));
+    std::uint64_t key = w | (h << 32);
+    auto it = ellipses.find(key);
+    if (it != ellipses.end()) {
+        ++hits;
+        return it->second;
+    }
+    ++misses;
+    
+    const float ppm = PhysicsBodyComponent::PIXELS_PER_METER;
+    const int numVertices = 8; // Box2D polygon vertex limit safety
+    b2Vec2 vertices[numVertices];
+    float halfWidth = static_cast<float>(w) / 2.0f / ppm;
+    float halfHeight = static_cast<float>(h) / 2.0f / ppm;
+    for (int i = 0; i < numVertices; ++i) {
+        float angle = (2.0f * 3.14159f * i) / numVertices;
+        vertices[i].x = halfWidth * std::cos(angle);
+        vertices[i].y = halfHeight * std::sin(angle);
+    }
+    b2Hull hull = b2ComputeHull(vertices, numVertices);
+    // A sliver thinner than Box2D's linear slop collapses; a box is the closest valid shape
+    b2Polygon polygon = hull.count >= 3 ? b2MakePolygon(&hull, 0.0f) : b2MakeBox(halfWidth, halfHeight);
+    return ellipses.emplace(key, polygon).first->second;
+}
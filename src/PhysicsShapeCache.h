@@ -0,0 +1,43 @@
+#pragma once
+#include "PhysicsBodyComponent.h"
+#include <box2d/box2d.h>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+// Box2D geometry shared by every body of the same shape, size and collision
+// scale. Spawning hundreds of asteroids then costs one hull computation per
+// distinct size instead of one per body. Keys are the collision extents after
+// scaling, rounded to whole pixels (at least 1), so a cached shape is within
+// half a pixel of the exact one at any sprite size.
+class PhysicsShapeCache {
+public:
+    static PhysicsShapeCache& getInstance() {
+        static PhysicsShapeCache instance;
+        return instance;
+    }
+    
+    PhysicsShapeCache(const PhysicsShapeCache&) = delete;
+    PhysicsShapeCache& operator=(const PhysicsShapeCache&) = delete;
+    
+    // Geometry in meters for a sprite-sized body (width/height in pixels)
+    const b2Circle& getCircle(float width, float height, float scaleX, float scaleY);
+    const b2Polygon& getEllipse(float width, float height, float scaleX, float scaleY);
+    
+    // Not thread-safe: read on the simulation thread (Engine copies them for F3)
+    size_t size() const { return circles.size() + ellipses.size(); }
+    size_t getHits() const { return hits; }
+    size_t getMisses() const { return misses; }
+    void clear() { circles.clear(); ellipses.clear(); }
+    
+private:
+    PhysicsShapeCache() = default;
+    
+    // Scaled extent in whole pixels, clamped to [1, 0xFFFFFFFF]
+    static std::uint64_t bucket(float pixels);
+    
+    std::unordered_map<std::uint64_t, b2Circle> circles;
+    std::unordered_map<std::uint64_t, b2Polygon> ellipses;
+    size_t hits = 0;
+    size_t misses = 0;
+};
@@ -0,0 +1,55 @@
+#include "PhysicsTasks.h"
+#include <algorithm>
+#include <iostream>
+
+void PhysicsTasks::configure(b2WorldDef& worldDef) {
+    JobSystem& jobs = JobSystem::getInstance();
+    workerCount = jobs.getWorkerCount() + 1;  // pool workers plus the stepping thread
+    if (workerCount > MaxWorkers) {
+        std::cerr << "PhysicsTasks: " << workerCount << " threads exceeds Box2D's limit of " << MaxWorkers
+                  << ", stepping physics single-threaded." << std::endl;
+        workerCount = 1;
+    }
+    if (workerCount <= 1) {
+        return;
+    }
+
+    worldDef.workerCount = workerCount;
+    worldDef.enqueueTask = &PhysicsTasks::enqueueTask;
+    worldDef.finishTask = &PhysicsTasks::finishTask;
+    worldDef.userTaskContext = this;
+}
+
+void* PhysicsTasks::enqueueTask(b2TaskCallback* task, int itemCount, int minRange, void* taskContext, void* userContext) {
+    auto* self = static_cast<PhysicsTasks*>(userContext);
+    if (self->taskCount == MaxTasks) {
+        // Out of slots: run serially, Box2D skips finishTask for a null handle
+        task(0, itemCount, 0, taskContext);
+        return nullptr;
+    }
+
+    Task& slot = self->tasks[self->taskCount++];
+    slot.jobs.clear();
+
+    // One range per worker at most, none smaller than Box2D asked for
+    minRange = std::max(minRange, 1);
+    int chunkCount = std::min(self->workerCount, std::max(itemCount / minRange, 1));
+    int chunkSize = (itemCount + chunkCount - 1) / chunkCount;
+
+    JobSystem& jobs = JobSystem::getInstance();
+    for (int begin = 0; begin < itemCount; begin += chunkSize) {
+        int end = std::min(begin + chunkSize, itemCount);
+        slot.jobs.push_back(jobs.schedule([task, begin, end, taskContext] {
+            uint32_t workerIndex = static_cast<uint32_t>(JobSystem::getCurrentWorkerIndex() + 1);
+            task(begin, end, workerIndex, taskContext);
+        }));
+    }
+    return &slot;
+}
+
+void PhysicsTasks::finishTask(void* userTask, void* /*userContext*/) {
+    // The stepping thread helps run queued jobs (as worker 0) while it waits
+    auto* slot = static_cast<Task*>(userTask);
+    JobSystem::getInstance().waitAll(slot->jobs);
+    slot->jobs.clear();
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "JobSystem.h"
+#include <box2d/box2d.h>
+#include <array>
+#include <vector>
+
+// Runs Box2D's solver tasks on the JobSystem pool.
+//
+// Box2D identifies each thread in a step by a worker index in [0, workerCount).
+// The thread calling b2World_Step is index 0; pool worker i is index i + 1.
+// Only the stepping thread and pool workers may run physics jobs while a step
+// is in flight, which holds because nothing else waits on the pool meanwhile.
+class PhysicsTasks {
+public:
+    static PhysicsTasks& getInstance() {
+        static PhysicsTasks instance;
+        return instance;
+    }
+
+    PhysicsTasks(const PhysicsTasks&) = delete;
+    PhysicsTasks& operator=(const PhysicsTasks&) = delete;
+
+    // Point a world definition at the pool. Leaves Box2D single-threaded when
+    // the pool has no workers. Call after JobSystem::start.
+    void configure(b2WorldDef& worldDef);
+
+    // Release this step's task slots; call after every b2World_Step
+    void endStep() { taskCount = 0; }
+
+    // Box2D allows at most 64 workers per world
+    static constexpr int MaxWorkers = 64;
+
+private:
+    PhysicsTasks() = default;
+
+    struct Task {
+        std::vector<JobHandle> jobs;
+    };
+
+    static void* enqueueTask(b2TaskCallback* task, int itemCount, int minRange, void* taskContext, void* userContext);
+    static void finishTask(void* userTask, void* userContext);
+
+    // Box2D enqueues a few dozen tasks per step; beyond this they run inline
+    static constexpr int MaxTasks = 128;
+    std::array<Task, MaxTasks> tasks;
+    int taskCount = 0;
+    int workerCount = 1;
+};
@@ -0,0 +1,33 @@
+#include "RenderSnapshot.h"
+
+void RenderSnapshot::clear() {
+    backgrounds.clear();
+    sprites.clear();
+    particles.clear();
+    debugBodies.clear();
+    physicsOverlay.clear();
+}
+
+RenderView RenderSnapshot::makeView(float alpha, int windowWidth, int windowHeight) const {
+    RenderView view;
+    view.centerX = lerpValue(prevViewX, viewX, alpha);
+    view.centerY = lerpValue(prevViewY, viewY, alpha);
+    view.scale = viewScale;
+    view.screenCenterX = windowWidth / 2.0f;
+    view.screenCenterY = windowHeight / 2.0f;
+    return view;
+}
+
+void RenderSnapshotBuffer::publish() {
+    slots[writeIndex].publishCounter = SDL_GetPerformanceCounter();
+    int previous = middle.exchange(writeIndex | FreshBit, std::memory_order_acq_rel);
+    writeIndex = previous & IndexMask;
+}
+
+const RenderSnapshot& RenderSnapshotBuffer::acquireLatest() {
+    if (middle.load(std::memory_order_acquire) & FreshBit) {
+        int previous = middle.exchange(readIndex, std::memory_order_acq_rel);
+        readIndex = previous & IndexMask;
+    }
+    return slots[readIndex];
+}
@@ -0,0 +1,146 @@
+#pragma once
+#include "View.h"
+#include <SDL2/SDL.h>
+#include <atomic>
+#include <string>
+#include <vector>
+
+enum class BodyType;
+enum class ShapeType;
+
+// Blend helpers used by the render side to interpolate between two simulation steps
+inline float lerpValue(float from, float to, float alpha) {
+    return from + (to - from) * alpha;
+}
+
+inline float lerpRotation(float fromDegrees, float toDegrees, float alpha) {
+    // Blend along the shortest arc so 179 -> -179 does not spin the long way round
+    float delta = toDegrees - fromDegrees;
+    while (delta > 180.0f) delta -= 360.0f;
+    while (delta < -180.0f) delta += 360.0f;
+    return fromDegrees + delta * alpha;
+}
+
+// Plain-data copies of what the renderer needs. Each carries the state at the
+// start (prev*) and end of the simulation step that produced the snapshot.
+struct SpriteInstance {
+    SDL_Texture* texture = nullptr;  // nullptr = draw a colored rect
+    SDL_FRect uv = {0.0f, 0.0f, 1.0f, 1.0f};  // normalized source rect within texture
+    float prevX = 0.0f, prevY = 0.0f;
+    float x = 0.0f, y = 0.0f;
+    float prevRotation = 0.0f, rotation = 0.0f;  // degrees
+    float width = 0.0f, height = 0.0f;
+    SDL_Color color = {255, 255, 255, 255};
+};
+
+struct BackgroundInstance {
+    SDL_Texture* texture = nullptr;
+    SDL_FRect uv = {0.0f, 0.0f, 1.0f, 1.0f};  // tile image within texture (atlas region)
+    float tileWidth = 0.0f, tileHeight = 0.0f;
+    float scrollSpeedX = 0.0f, scrollSpeedY = 0.0f;
+};
+
+struct ParticleInstance {
+    float prevX = 0.0f, prevY = 0.0f;
+    float x = 0.0f, y = 0.0f;
+    float size = 0.0f;
+    SDL_Color color = {255, 255, 255, 255};
+};
+
+struct DebugBodyInstance {
+    float prevX = 0.0f, prevY = 0.0f;
+    float x = 0.0f, y = 0.0f;
+    float prevRotation = 0.0f, rotation = 0.0f;  // degrees
+    float width = 0.0f, height = 0.0f;
+    float velocityX = 0.0f, velocityY = 0.0f;    // pixels per second
+    BodyType bodyType;
+    ShapeType shapeType;
+};
+
+// Camera used while drawing one frame (interpolated from a snapshot)
+struct RenderView {
+    float centerX = 0.0f;
+    float centerY = 0.0f;
+    float scale = 1.0f;
+    float screenCenterX = 0.0f;
+    float screenCenterY = 0.0f;
+    
+    SDL_FRect worldToScreen(const SDL_FRect& worldRect) const {
+        return {
+            (worldRect.x - centerX) * scale + screenCenterX,
+            (worldRect.y - centerY) * scale + screenCenterY,
+            worldRect.w * scale,
+            worldRect.h * scale
+        };
+    }
+    
+    // World-space area covered by the window; see View::getVisibleBounds
+    WorldBounds getVisibleBounds() const {
+        float halfWidth = screenCenterX / scale;
+        float halfHeight = screenCenterY / scale;
+        return {centerX - halfWidth, centerY - halfHeight, centerX + halfWidth, centerY + halfHeight};
+    }
+};
+
+// Items drawn vs rejected by view culling during one frame
+struct CullStats {
+    int drawn = 0;
+    int culled = 0;
+};
+
+struct RenderCullStats {
+    CullStats sprites;
+    CullStats particles;
+    CullStats debugBodies;
+};
+
+// Immutable (once published) copy of one simulation step for the renderer
+struct RenderSnapshot {
+    std::vector<BackgroundInstance> backgrounds;
+    std::vector<SpriteInstance> sprites;
+    std::vector<ParticleInstance> particles;
+    std::vector<DebugBodyInstance> debugBodies;
+    std::vector<std::string> physicsOverlay;  // PhysicsProfiler text, empty when the overlay is hidden
+    
+    float prevViewX = 0.0f, prevViewY = 0.0f;
+    float viewX = 0.0f, viewY = 0.0f;
+    float viewScale = 1.0f;
+    
+    // HUD
+    int score = 0;
+    int highScore = 0;
+    bool gameOver = false;
+    
+    unsigned long long tick = 0;   // fixed steps simulated when captured
+    Uint64 publishCounter = 0;     // SDL_GetPerformanceCounter() at publish
+    
+    // Empties the lists but keeps their capacity so steady state does not allocate
+    void clear();
+    
+    RenderView makeView(float alpha, int windowWidth, int windowHeight) const;
+};
+
+// Lock-free triple buffer: the simulation always has a slot to write, the renderer
+// always reads the most recently published one, and neither ever waits.
+class RenderSnapshotBuffer {
+public:
+    RenderSnapshotBuffer() = default;
+    RenderSnapshotBuffer(const RenderSnapshotBuffer&) = delete;
+    RenderSnapshotBuffer& operator=(const RenderSnapshotBuffer&) = delete;
+    
+    // Producer side (simulation)
+    RenderSnapshot& beginWrite() { return slots[writeIndex]; }
+    void publish();
+    
+    // Consumer side (renderer): swaps in the newest snapshot if one was published
+    const RenderSnapshot& acquireLatest();
+    
+private:
+    static constexpr int FreshBit = 0x4;
+    static constexpr int IndexMask = 0x3;
+    
+    RenderSnapshot slots[3];
+    int writeIndex = 0;
+    int readIndex = 1;
+    std::atomic<int> middle{2};  // slot index | FreshBit when unread
+};
@@ -14,10 +14,9 @@ void RotateToMouseComponent::init() {
 void RotateToMouseComponent::update(float deltaTime) {
     if (!transform) return;
     
-    // Get mouse position in screen space (refresh directly to avoid latency)
-    int mouseScreenX = 0;
-    int mouseScreenY = 0;
-    SDL_GetMouseState(&mouseScreenX, &mouseScreenY);
+    // Get mouse position in screen space from this step's input
+    int mouseScreenX = Engine::getMouseX();
+    int mouseScreenY = Engine::getMouseY();
     
     // Convert screen to world using View helper
     float mouseWorldX, mouseWorldY;
@@ -10,6 +10,7 @@ public:
     
     void init() override;
     void update(float deltaTime) override;
+    UpdatePhase getUpdatePhase() const override { return UpdatePhase::Gameplay; }
     
     // Backward compatibility: if only rotationSpeed is provided, we derive accel/decel
     void setRotationSpeed(float speed) { maxAngularSpeed = speed; }
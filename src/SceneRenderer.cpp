@@ -0,0 +1,90 @@
+#include "SceneRenderer.h"
+#include "RenderSnapshot.h"
+#include <cmath>
+
+void SceneRenderer::renderBackgrounds(const RenderSnapshot& snapshot, const RenderView& view, int windowWidth, int windowHeight) {
+    // Every layer's tiles go into one vertex buffer, so consecutive layers that share a
+    // texture (or atlas page) cost one SDL_RenderGeometry call together. SDL2 cannot wrap
+    // UVs, so the wrap-around is done with one quad per visible tile.
+    backgroundBatch.begin();
+    SDL_Texture* previousTexture = nullptr;
+    for (const BackgroundInstance& bg : snapshot.backgrounds) {
+        if (bg.tileWidth <= 0.0f || bg.tileHeight <= 0.0f) continue;
+        
+        // Batches draw in texture order; submit so far when the texture changes to keep layers in order
+        if (previousTexture && bg.texture != previousTexture) {
+            backgroundBatch.end();
+            backgroundBatch.begin();
+        }
+        previousTexture = bg.texture;
+        
+        // Calculate offset based on scroll speed (parallax effect)
+        // Negate to scroll in the opposite direction of camera movement
+        float offsetX = -view.centerX * bg.scrollSpeedX;
+        float offsetY = -view.centerY * bg.scrollSpeedY;
+        
+        // Starting position wrapped to the tile size, at or left of/above the screen edge
+        float startX = std::fmod(offsetX, bg.tileWidth);
+        float startY = std::fmod(offsetY, bg.tileHeight);
+        if (startX > 0) startX -= bg.tileWidth;
+        if (startY > 0) startY -= bg.tileHeight;
+        
+        // Only the tiles that touch the screen
+        int tilesX = static_cast<int>(std::ceil((windowWidth - startX) / bg.tileWidth));
+        int tilesY = static_cast<int>(std::ceil((windowHeight - startY) / bg.tileHeight));
+        
+        for (int y = 0; y < tilesY; ++y) {
+            for (int x = 0; x < tilesX; ++x) {
+                // Whole pixels so neighboring tiles meet without seams
+                SDL_FRect destRect = {
+                    std::floor(startX + x * bg.tileWidth),
+                    std::floor(startY + y * bg.tileHeight),
+                    std::floor(startX + (x + 1) * bg.tileWidth) - std::floor(startX + x * bg.tileWidth),
+                    std::floor(startY + (y + 1) * bg.tileHeight) - std::floor(startY + y * bg.tileHeight)
+                };
+                backgroundBatch.draw(bg.texture, destRect, 0.0f, SDL_Color{255, 255, 255, 255}, &bg.uv);
+            }
+        }
+    }
+    backgroundBatch.end();
+}
+
+void SceneRenderer::renderSprites(const RenderSnapshot& snapshot, const RenderView& view, float alpha, CullStats& cull) {
+    const WorldBounds visible = view.getVisibleBounds();
+    
+    // One SDL_RenderGeometry call per texture instead of one copy per sprite
+    spriteBatch.begin();
+    for (const SpriteInstance& sprite : snapshot.sprites) {
+        // Blend between the two simulation steps so motion is smooth at any render rate
+        float x = lerpValue(sprite.prevX, sprite.x, alpha);
+        float y = lerpValue(sprite.prevY, sprite.y, alpha);
+        
+        // Half the diagonal covers the sprite at any rotation
+        float halfExtent = 0.5f * std::sqrt(sprite.width * sprite.width + sprite.height * sprite.height);
+        if (!visible.overlaps(x, y, halfExtent)) {
+            ++cull.culled;
+            continue;
+        }
+        ++cull.drawn;
+        
+        // Create world space rectangle centered on the sprite position
+        SDL_FRect worldRect = {
+            x - sprite.width / 2.0f,
+            y - sprite.height / 2.0f,
+            sprite.width,
+            sprite.height
+        };
+        SDL_FRect screenRect = view.worldToScreen(worldRect);
+        float angle = lerpRotation(sprite.prevRotation, sprite.rotation, alpha);
+        
+        // Textured quads are drawn untinted; sprites without a texture are flat-colored quads.
+        // Atlased sprites share their page texture, and so one batch.
+        SDL_Color color = sprite.texture ? SDL_Color{255, 255, 255, 255} : sprite.color;
+        spriteBatch.draw(sprite.texture, screenRect, angle, color, &sprite.uv);
+    }
+    spriteBatch.end();
+}
+
+void SceneRenderer::renderParticles(const RenderSnapshot& snapshot, const RenderView& view, float alpha, CullStats& cull) {
+    particleRenderer.render(snapshot.particles, view, alpha, cull);
+}
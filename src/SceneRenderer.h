@@ -0,0 +1,31 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include "ParticleRenderer.h"
+#include "SpriteBatch.h"
+
+struct RenderSnapshot;
+struct RenderView;
+struct CullStats;
+
+// Draws the world part of a RenderSnapshot (background layers, sprites and particles).
+// Runs on whichever thread owns the SDL renderer.
+class SceneRenderer {
+public:
+    explicit SceneRenderer(SDL_Renderer* renderer)
+        : renderer(renderer), backgroundBatch(renderer), spriteBatch(renderer), particleRenderer(renderer) {}
+    
+    void renderBackgrounds(const RenderSnapshot& snapshot, const RenderView& view, int windowWidth, int windowHeight);
+    void renderSprites(const RenderSnapshot& snapshot, const RenderView& view, float alpha, CullStats& cull);
+    void renderParticles(const RenderSnapshot& snapshot, const RenderView& view, float alpha, CullStats& cull);
+    
+    void setSoftParticles(bool enabled) { particleRenderer.setSoftTexture(enabled); }
+    
+    // Draw calls, vertices and quads submitted for sprites in the last frame
+    const SpriteBatch::Stats& getSpriteStats() const { return spriteBatch.getStats(); }
+    
+private:
+    SDL_Renderer* renderer = nullptr;
+    SpriteBatch backgroundBatch;  // tiles of every parallax layer
+    SpriteBatch spriteBatch;
+    ParticleRenderer particleRenderer;
+};
@@ -1,6 +1,8 @@
 #include "Settings.h"
 #include <tinyxml2.h>
 #include <iostream>
+#include <cstdlib>
+#include <cstring>
 
 bool loadSettingsFromXML(const std::string& path, Settings& out) {
     tinyxml2::XMLDocument doc;
@@ -25,11 +27,30 @@ bool loadSettingsFromXML(const std::string& path, Settings& out) {
     if (auto* timing = settingsElem->FirstChildElement("timing")) {
         timing->QueryIntAttribute("renderFPS", &out.renderFPS);
         timing->QueryIntAttribute("logicFPS", &out.logicFPS);
+        timing->QueryIntAttribute("maxStepsPerFrame", &out.maxStepsPerFrame);
+        timing->QueryBoolAttribute("simulationThread", &out.simulationThread);
+    }
+    if (auto* threading = settingsElem->FirstChildElement("threading")) {
+        threading->QueryIntAttribute("workers", &out.jobWorkers);
+    }
+    if (auto* particles = settingsElem->FirstChildElement("particles")) {
+        particles->QueryBoolAttribute("softTexture", &out.softParticles);
     }
     if (auto* audio = settingsElem->FirstChildElement("audio")) {
         audio->QueryIntAttribute("explosionVolume", &out.explosionVolume);
         audio->QueryIntAttribute("rocketVolume", &out.rocketVolume);
     }
+    if (auto* simulation = settingsElem->FirstChildElement("simulation")) {
+        simulation->QueryBoolAttribute("headless", &out.headless);
+        simulation->QueryFloatAttribute("timeScale", &out.timeScale);
+        simulation->QueryIntAttribute("maxTicks", &out.maxTicks);
+        simulation->QueryUnsignedAttribute("seed", &out.seed);
+    }
+    if (auto* profiling = settingsElem->FirstChildElement("profiling")) {
+        profiling->QueryBoolAttribute("enabled", &out.profile);
+        if (const char* csv = profiling->Attribute("csv")) out.profileCSV = csv;
+        profiling->QueryIntAttribute("window", &out.profileWindow);
+    }
     // Basic sanity clamps
     if (out.width < 320){ 
         out.width = 320;
@@ -51,9 +72,50 @@ bool loadSettingsFromXML(const std::string& path, Settings& out) {
         out.logicFPS = 15;
         std::cerr << "Settings: logicFPS too low, clamped to 15." << std::endl;
     }
+    if (out.maxStepsPerFrame < 1){ 
+        out.maxStepsPerFrame = 1;
+        std::cerr << "Settings: maxStepsPerFrame too low, clamped to 1." << std::endl;
+    }
     // if (out.logicFPS > 240){ 
     //     out.logicFPS = 240;
     //     std::cerr << "Settings: logicFPS too high, clamped to 240." << std::endl;
     // }
+    if (out.profileWindow < 16){ 
+        out.profileWindow = 16;
+        std::cerr << "Settings: profiling window too small, clamped to 16." << std::endl;
+    }
     return true;
 }
+
+void applyCommandLine(int argc, char* argv[], Settings& out) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (std::strcmp(arg, "--headless") == 0) {
+            out.headless = true;
+        } else if (std::strncmp(arg, "--timescale=", 12) == 0) {
+            out.timeScale = static_cast<float>(std::atof(arg + 12));
+        } else if (std::strncmp(arg, "--ticks=", 8) == 0) {
+            out.maxTicks = std::atoi(arg + 8);
+        } else if (std::strcmp(arg, "--profile") == 0) {
+            out.profile = true;
+        } else if (std::strncmp(arg, "--profile=", 10) == 0) {
+            out.profile = true;
+            out.profileCSV = arg + 10;
+        } else if (std::strncmp(arg, "--seed=", 7) == 0) {
+            out.seed = static_cast<unsigned int>(std::strtoul(arg + 7, nullptr, 10));
+        } else if (std::strncmp(arg, "--record=", 9) == 0) {
+            out.recordInputPath = arg + 9;
+        } else if (std::strncmp(arg, "--replay=", 9) == 0) {
+            out.replayInputPath = arg + 9;
+        } else if (std::strcmp(arg, "--single-thread") == 0) {
+            out.simulationThread = false;
+        } else if (std::strncmp(arg, "--workers=", 10) == 0) {
+            out.jobWorkers = std::atoi(arg + 10);
+        } else {
+            std::cerr << "Settings: ignoring unknown argument '" << arg << "'." << std::endl;
+        }
+    }
+    if (out.maxTicks < 0) {
+        out.maxTicks = 0;
+    }
+}
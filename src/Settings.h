@@ -6,12 +6,30 @@ struct Settings {
     int height = 720;
     int renderFPS = 60;
     int logicFPS = 60;
+    int maxStepsPerFrame = 8;   // fixed updates allowed per frame before time is dropped
+    bool simulationThread = true;  // run fixed updates on their own thread, render from snapshots
     int explosionVolume = 80;   // 0-128 (62% of max)
     int rocketVolume = 40;      // 0-128 (31% of max)
+    bool softParticles = true;  // draw particles with a soft-circle texture instead of flat squares
+    int jobWorkers = -1;        // job system threads (-1 = hardware threads minus main/simulation, 0 = inline)
+    // Simulation
+    bool headless = false;      // no window/renderer/audio; simulation only
+    float timeScale = 1.0f;     // simulated seconds per real second (<= 0 = as fast as possible)
+    int maxTicks = 0;           // stop after this many fixed updates (0 = unlimited)
+    unsigned int seed = 0;      // rand() seed (0 = pick one from the clock and print it)
+    std::string recordInputPath;  // write per-tick input to this file
+    std::string replayInputPath;  // feed per-tick input from this file (overrides seed/logicFPS/window size)
+    // Profiling
+    bool profile = false;       // time engine phases (F3 prints a summary)
+    std::string profileCSV = "profile.csv";  // written on exit when profiling
+    int profileWindow = 1024;   // rolling samples kept per phase
     // Future fields:
     // int physicsSubsteps = 1;
-    // float timeScale = 1.0f;
 };
 
 // Loads settings from the given XML path. Returns true if loaded, false if fallback used.
 bool loadSettingsFromXML(const std::string& path, Settings& out);
+
+// Applies command line overrides (--headless, --timescale=X, --ticks=N, --profile[=csv], --single-thread,
+// --workers=N, --seed=N, --record=file, --replay=file) on top of loaded settings.
+void applyCommandLine(int argc, char* argv[], Settings& out);
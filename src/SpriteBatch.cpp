@@ -0,0 +1,76 @@
+#include "SpriteBatch.h"
+#include <cmath>
+
+void SpriteBatch::begin() {
+    for (size_t i = 0; i < activeBatches; ++i) {
+        batches[i].vertices.clear();
+        batches[i].indices.clear();
+    }
+    activeBatches = 0;
+}
+
+SpriteBatch::Batch& SpriteBatch::batchFor(SDL_Texture* texture) {
+    // A handful of textures per frame, so a linear scan beats hashing
+    for (size_t i = 0; i < activeBatches; ++i) {
+        if (batches[i].texture == texture) return batches[i];
+    }
+    if (activeBatches == batches.size()) {
+        batches.emplace_back();
+    }
+    Batch& batch = batches[activeBatches++];
+    batch.texture = texture;
+    return batch;
+}
+
+void SpriteBatch::draw(SDL_Texture* texture, const SDL_FRect& screenRect, float angleDegrees,
+                       SDL_Color color, const SDL_FRect* uv) {
+    Batch& batch = batchFor(texture);
+    
+    const float halfW = screenRect.w * 0.5f;
+    const float halfH = screenRect.h * 0.5f;
+    const float centerX = screenRect.x + halfW;
+    const float centerY = screenRect.y + halfH;
+    const float radians = angleDegrees * 3.14159265f / 180.0f;
+    const float c = std::cos(radians);
+    const float s = std::sin(radians);
+    
+    const float u0 = uv ? uv->x : 0.0f;
+    const float v0 = uv ? uv->y : 0.0f;
+    const float u1 = uv ? uv->x + uv->w : 1.0f;
+    const float v1 = uv ? uv->y + uv->h : 1.0f;
+    
+    // Corners clockwise from top-left, rotated about the center (y points down)
+    const float cornerX[4] = {-halfW, halfW, halfW, -halfW};
+    const float cornerY[4] = {-halfH, -halfH, halfH, halfH};
+    const float cornerU[4] = {u0, u1, u1, u0};
+    const float cornerV[4] = {v0, v0, v1, v1};
+    
+    const int base = static_cast<int>(batch.vertices.size());
+    for (int i = 0; i < 4; ++i) {
+        SDL_Vertex vertex;
+        vertex.position.x = centerX + cornerX[i] * c - cornerY[i] * s;
+        vertex.position.y = centerY + cornerX[i] * s + cornerY[i] * c;
+        vertex.color = color;
+        vertex.tex_coord.x = cornerU[i];
+        vertex.tex_coord.y = cornerV[i];
+        batch.vertices.push_back(vertex);
+    }
+    const int quadIndices[6] = {0, 1, 2, 0, 2, 3};
+    for (int index : quadIndices) {
+        batch.indices.push_back(base + index);
+    }
+}
+
+void SpriteBatch::end() {
+    stats = Stats();
+    for (size_t i = 0; i < activeBatches; ++i) {
+        const Batch& batch = batches[i];
+        if (batch.vertices.empty()) continue;
+        SDL_RenderGeometry(renderer, batch.texture,
+                           batch.vertices.data(), static_cast<int>(batch.vertices.size()),
+                           batch.indices.data(), static_cast<int>(batch.indices.size()));
+        ++stats.drawCalls;
+        stats.vertices += static_cast<int>(batch.vertices.size());
+        stats.quads += static_cast<int>(batch.vertices.size() / 4);
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <vector>
+
+// Collects textured quads into one vertex/index buffer per texture and submits
+// each with a single SDL_RenderGeometry call. Rotation is applied on the CPU,
+// so a field of asteroids sharing a texture is one draw call instead of one
+// SDL_RenderCopyEx each.
+//
+// Batches are drawn in the order their texture first appeared since begin(),
+// so sprites of different textures overlap in that order rather than strictly
+// in submission order. A null texture draws flat-colored quads.
+class SpriteBatch {
+public:
+    struct Stats {
+        int drawCalls = 0;
+        int vertices = 0;
+        int quads = 0;
+    };
+    
+    explicit SpriteBatch(SDL_Renderer* renderer) : renderer(renderer) {}
+    
+    void begin();
+    
+    // screenRect is the unrotated destination; the quad is rotated by angleDegrees
+    // (clockwise, like SDL_RenderCopyEx) about its center. uv selects a normalized
+    // sub-rectangle of the texture (nullptr = whole texture).
+    void draw(SDL_Texture* texture, const SDL_FRect& screenRect, float angleDegrees,
+              SDL_Color color = {255, 255, 255, 255}, const SDL_FRect* uv = nullptr);
+    
+    // Submit every batch and record the frame's stats
+    void end();
+    
+    // Counts for the most recent end()
+    const Stats& getStats() const { return stats; }
+    
+private:
+    struct Batch {
+        SDL_Texture* texture = nullptr;
+        std::vector<SDL_Vertex> vertices;
+        std::vector<int> indices;
+    };
+    
+    Batch& batchFor(SDL_Texture* texture);
+    
+    SDL_Renderer* renderer = nullptr;
+    std::vector<Batch> batches;  // kept across frames so buffers keep their capacity
+    size_t activeBatches = 0;
+    Stats stats;
+};
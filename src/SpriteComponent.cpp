@@ -1,18 +1,59 @@
 #include "SpriteComponent.h"
 #include "GameObject.h"
 #include "TransformComponent.h"
-#include "Engine.h"
-#include "View.h"
 #include "AssetManager.h"
+#include <iostream>
 
 void SpriteComponent::init() {
     transform = owner->getComponent<TransformComponent>();
+    if (!transform) {
+        std::cerr << "SpriteComponent: owner has no TransformComponent, sprite will not be drawn" << std::endl;
+        return;
+    }
+    ComponentStore::getInstance().hasSprite[transform->getRow()] = 1;
+}
+
+SpriteComponent::~SpriteComponent() {
+    // Components are destroyed in reverse order, so the transform row is still ours
+    if (transform) {
+        ComponentStore::getInstance().hasSprite[transform->getRow()] = 0;
+    }
+}
+
+void SpriteComponent::setTexture(const std::string& textureId) {
+    this->textureId = textureId;
+    if (!transform) return;
+    // Resolved once here (assets load before objects)
+    TextureRegion region = textureId.empty() ? TextureRegion() : AssetManager::getInstance().getTexture(textureId);
+    ComponentStore& store = ComponentStore::getInstance();
+    store.texture[transform->getRow()] = region.texture;
+    store.textureUV[transform->getRow()] = region.uv;
+}
+
+void SpriteComponent::setSize(float w, float h) {
+    if (!transform) return;
+    ComponentStore& store = ComponentStore::getInstance();
+    store.width[transform->getRow()] = w;
+    store.height[transform->getRow()] = h;
+}
+
+void SpriteComponent::setColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+    if (!transform) return;
+    ComponentStore::getInstance().color[transform->getRow()] = {r, g, b, a};
+}
+
+float SpriteComponent::getWidth() const {
+    return transform ? ComponentStore::getInstance().width[transform->getRow()] : 50.0f;
+}
+
+float SpriteComponent::getHeight() const {
+    return transform ? ComponentStore::getInstance().height[transform->getRow()] : 50.0f;
 }
 
 void SpriteComponent::setSizePreserveAspect(float size, bool useWidth) {
     if (textureId.empty()) {
         // No texture, just set both to size
-        width = height = size;
+        setSize(size, size);
         return;
     }
     
@@ -20,49 +61,12 @@ void SpriteComponent::setSizePreserveAspect(float size, bool useWidth) {
     if (AssetManager::getInstance().getTextureDimensions(textureId, texWidth, texHeight)) {
         float aspectRatio = static_cast<float>(texWidth) / static_cast<float>(texHeight);
         if (useWidth) {
-            width = size;
-            height = size / aspectRatio;
+            setSize(size, size / aspectRatio);
         } else {
-            height = size;
-            width = size * aspectRatio;
+            setSize(size * aspectRatio, size);
         }
     } else {
         // Couldn't get dimensions, fall back to square
-        width = height = size;
-    }
-}
-
-void SpriteComponent::render() {
-    if (!transform) return;
-    
-    SDL_Renderer* renderer = Engine::getInstance().getRenderer();
-    
-    // Create world space rectangle centered on transform position
-    SDL_Rect worldRect = {
-        static_cast<int>(transform->getX() - width / 2.0f),
-        static_cast<int>(transform->getY() - height / 2.0f),
-        static_cast<int>(width),
-        static_cast<int>(height)
-    };
-    
-    // Transform to screen space using View
-    SDL_Rect screenRect = View::getInstance().worldToScreen(worldRect);
-    
-    // Get rotation from transform
-    double angle = transform->getRotation();
-    
-    // Draw with texture if available, otherwise use color
-    if (!textureId.empty()) {
-        SDL_Texture* texture = AssetManager::getInstance().getTexture(textureId);
-        if (texture) {
-            // Center point for rotation in screen space (middle of sprite)
-            SDL_Point center = { screenRect.w / 2, screenRect.h / 2 };
-            SDL_RenderCopyEx(renderer, texture, nullptr, &screenRect, angle, &center, SDL_FLIP_NONE);
-            return;
-        }
+        setSize(size, size);
     }
-    
-    // Fallback to colored rectangle (rotation not supported for colored rects)
-    SDL_SetRenderDrawColor(renderer, r, g, b, a);
-    SDL_RenderFillRect(renderer, &screenRect);
 }
@@ -0,0 +1,35 @@
+#include "Tags.h"
+#include <iostream>
+
+std::vector<std::string>& Tags::names() {
+    // Built-in tags first so their IDs match the constants in Tags.h
+    static std::vector<std::string> registered = {"background", "player", "asteroid", "explosion"};
+    return registered;
+}
+
+TagId Tags::intern(const std::string& name) {
+    TagId existing = find(name);
+    if (existing != Invalid) return existing;
+    
+    std::vector<std::string>& all = names();
+    if (all.size() >= MaxTags) {
+        std::cerr << "Tags: cannot register '" << name << "', all " << int(MaxTags) << " tags are in use" << std::endl;
+        return Invalid;
+    }
+    all.push_back(name);
+    return static_cast<TagId>(all.size() - 1);
+}
+
+TagId Tags::find(const std::string& name) {
+    const std::vector<std::string>& all = names();
+    for (size_t i = 0; i < all.size(); ++i) {
+        if (all[i] == name) return static_cast<TagId>(i);
+    }
+    return Invalid;
+}
+
+const std::string& Tags::getName(TagId id) {
+    static const std::string none;
+    const std::vector<std::string>& all = names();
+    return id < all.size() ? all[id] : none;
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Tags are interned to small integer IDs so checks are a bit test instead of a
+// string compare. A GameObject carries a bitmask, so it can have several tags.
+using TagId = std::uint8_t;
+using TagMask = std::uint32_t;
+
+class Tags {
+public:
+    static constexpr TagId MaxTags = 32;
+    static constexpr TagId Invalid = 0xFF;
+    
+    // Tags the engine itself uses (registered in this order at startup)
+    static constexpr TagId Background = 0;
+    static constexpr TagId Player = 1;
+    static constexpr TagId Asteroid = 2;
+    static constexpr TagId Explosion = 3;
+    
+    // Returns the ID for a name, registering it on first use (Invalid once MaxTags are in use)
+    static TagId intern(const std::string& name);
+    // Returns the ID for a name without registering it (Invalid if unknown)
+    static TagId find(const std::string& name);
+    static const std::string& getName(TagId id);
+    
+    static TagMask toMask(TagId id) { return id < MaxTags ? (TagMask(1) << id) : 0; }
+    
+private:
+    static std::vector<std::string>& names();
+};
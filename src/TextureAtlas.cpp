@@ -0,0 +1,72 @@
+#include "TextureAtlas.h"
+#include <algorithm>
+#include <climits>
+
+SkylinePacker::SkylinePacker(int width, int height)
+    : pageWidth(width), pageHeight(height) {
+    skyline.push_back({0, 0, width});
+}
+
+int SkylinePacker::fitAt(size_t index, int width, int height) const {
+    int x = skyline[index].x;
+    if (x + width > pageWidth) return -1;
+
+    // Rest on the highest segment the rectangle spans
+    int y = 0;
+    int remaining = width;
+    for (size_t i = index; remaining > 0; ++i) {
+        y = std::max(y, skyline[i].y);
+        if (y + height > pageHeight) return -1;
+        remaining -= skyline[i].width;
+    }
+    return y;
+}
+
+bool SkylinePacker::insert(int width, int height, SDL_Point& position) {
+    if (width <= 0 || height <= 0) return false;
+
+    size_t bestIndex = skyline.size();
+    int bestBottom = INT_MAX;
+    int bestY = 0;
+    for (size_t i = 0; i < skyline.size(); ++i) {
+        int y = fitAt(i, width, height);
+        if (y >= 0 && y + height < bestBottom) {
+            bestIndex = i;
+            bestBottom = y + height;
+            bestY = y;
+        }
+    }
+    if (bestIndex == skyline.size()) return false;
+
+    position = {skyline[bestIndex].x, bestY};
+
+    // The new rectangle's top becomes a segment; trim whatever it now covers
+    Segment placed = {position.x, bestY + height, width};
+    skyline.insert(skyline.begin() + bestIndex, placed);
+    const int placedRight = placed.x + placed.width;
+    size_t next = bestIndex + 1;
+    while (next < skyline.size() && skyline[next].x < placedRight) {
+        int overlap = placedRight - skyline[next].x;
+        if (overlap >= skyline[next].width) {
+            skyline.erase(skyline.begin() + next);
+        } else {
+            skyline[next].x += overlap;
+            skyline[next].width -= overlap;
+            break;
+        }
+    }
+
+    // Merge neighbors at the same height so the list stays short
+    for (size_t i = 0; i + 1 < skyline.size();) {
+        if (skyline[i].y == skyline[i + 1].y) {
+            skyline[i].width += skyline[i + 1].width;
+            skyline.erase(skyline.begin() + i + 1);
+        } else {
+            ++i;
+        }
+    }
+
+    usedWidth = std::max(usedWidth, placedRight);
+    usedHeight = std::max(usedHeight, placed.y);
+    return true;
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <vector>
+
+// Where a texture's pixels live: a whole standalone texture, or a
+// sub-rectangle of an atlas page shared with other textures
+struct TextureRegion {
+    SDL_Texture* texture = nullptr;
+    SDL_Rect source = {0, 0, 0, 0};             // pixels within texture
+    SDL_FRect uv = {0.0f, 0.0f, 1.0f, 1.0f};    // source normalized to the texture size
+    bool atlased = false;                       // texture is a shared atlas page
+};
+
+// Skyline bottom-left rectangle packer. The packed area is described by its
+// top edge (the skyline), a list of horizontal segments; each rectangle goes
+// where it would sit lowest on that edge, ties broken by the leftmost spot.
+// Cheap and tight enough for a handful of sprite images packed once at load.
+class SkylinePacker {
+public:
+    SkylinePacker(int width, int height);
+
+    // Reserve a width x height area; false if it does not fit on this page
+    bool insert(int width, int height, SDL_Point& position);
+
+    // Extent of everything packed so far; the page can be trimmed to it
+    int getUsedWidth() const { return usedWidth; }
+    int getUsedHeight() const { return usedHeight; }
+
+private:
+    struct Segment {
+        int x, y, width;
+    };
+
+    // Y at which a rectangle of the given width rests when its left edge is at
+    // segment index's x; -1 if it runs off the page
+    int fitAt(size_t index, int width, int height) const;
+
+    int pageWidth;
+    int pageHeight;
+    int usedWidth = 0;
+    int usedHeight = 0;
+    std::vector<Segment> skyline;
+};
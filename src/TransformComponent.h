@@ -1,39 +1,59 @@
 #pragma once
 #include "Component.h"
+#include "ObjectPool.h"
+#include "ComponentStore.h"
 
-class TransformComponent : public Component {
+// Facade over this object's row in ComponentStore. Position, velocity and
+// rotation live in the store's columns; velocity is integrated (for objects
+// without a physics body) by ComponentStore::integrateVelocities.
+class TransformComponent : public Component, public Pooled<TransformComponent> {
 public:
-    TransformComponent() = default;
+    TransformComponent() : row(ComponentStore::getInstance().addRow(this)) {}
+    ~TransformComponent() override { ComponentStore::getInstance().removeRow(row); }
+    
+    TransformComponent(const TransformComponent&) = delete;
+    TransformComponent& operator=(const TransformComponent&) = delete;
     
     void setPosition(float x, float y) {
-        this->x = x;
-        this->y = y;
+        ComponentStore& store = ComponentStore::getInstance();
+        store.x[row] = x;
+        store.y[row] = y;
     }
     
     void setVelocity(float vx, float vy) {
-        this->velocityX = vx;
-        this->velocityY = vy;
+        ComponentStore& store = ComponentStore::getInstance();
+        store.velocityX[row] = vx;
+        store.velocityY[row] = vy;
     }
     
     void setRotation(float angleDegrees) {
-        this->rotation = angleDegrees;
+        ComponentStore::getInstance().rotation[row] = angleDegrees;
     }
     
-    void update(float deltaTime) override {
-        x += velocityX * deltaTime;
-        y += velocityY * deltaTime;
+    float getX() const { return ComponentStore::getInstance().x[row]; }
+    float getY() const { return ComponentStore::getInstance().y[row]; }
+    float getVelocityX() const { return ComponentStore::getInstance().velocityX[row]; }
+    float getVelocityY() const { return ComponentStore::getInstance().velocityY[row]; }
+    float getRotation() const { return ComponentStore::getInstance().rotation[row]; }
+    
+    // Render interpolation: state at the start of the current fixed step
+    // (ComponentStore::storePrevious); newly spawned objects report their current state
+    float getPreviousX() const {
+        const ComponentStore& store = ComponentStore::getInstance();
+        return store.hasPrevious[row] ? store.prevX[row] : store.x[row];
+    }
+    float getPreviousY() const {
+        const ComponentStore& store = ComponentStore::getInstance();
+        return store.hasPrevious[row] ? store.prevY[row] : store.y[row];
+    }
+    float getPreviousRotation() const {
+        const ComponentStore& store = ComponentStore::getInstance();
+        return store.hasPrevious[row] ? store.prevRotation[row] : store.rotation[row];
     }
     
-    float getX() const { return x; }
-    float getY() const { return y; }
-    float getVelocityX() const { return velocityX; }
-    float getVelocityY() const { return velocityY; }
-    float getRotation() const { return rotation; }
+    size_t getRow() const { return row; }  // changes when other rows are removed
     
 private:
-    float x = 0.0f;
-    float y = 0.0f;
-    float velocityX = 0.0f;
-    float velocityY = 0.0f;
-    float rotation = 0.0f;  // Angle in degrees (0 = right)
+    friend class ComponentStore;  // rewrites row after a swap-remove
+    size_t row;
 };
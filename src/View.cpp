@@ -16,6 +16,16 @@ void View::getCenter(float& x, float& y) const {
     y = centerY;
 }
 
+void View::storePrevious() {
+    prevCenterX = centerX;
+    prevCenterY = centerY;
+}
+
+void View::getPreviousCenter(float& x, float& y) const {
+    x = prevCenterX;
+    y = prevCenterY;
+}
+
 SDL_Rect View::worldToScreen(const SDL_Rect& worldRect) const {
     // Get window dimensions from Engine
     float screenCenterX = Engine::getInstance().getWindowWidth() / 2.0f;
@@ -39,3 +49,9 @@ void View::screenToWorld(int screenX, int screenY, float& worldX, float& worldY)
     worldX = (screenX - screenCenterX) / scale + centerX;
     worldY = (screenY - screenCenterY) / scale + centerY;
 }
+
+WorldBounds View::getVisibleBounds() const {
+    float halfWidth = Engine::getInstance().getWindowWidth() / 2.0f / scale;
+    float halfHeight = Engine::getInstance().getWindowHeight() / 2.0f / scale;
+    return {centerX - halfWidth, centerY - halfHeight, centerX + halfWidth, centerY + halfHeight};
+}
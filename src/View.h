@@ -1,6 +1,18 @@
 #pragma once
 #include <SDL2/SDL.h>
 
+// Axis-aligned world-space rectangle, used to cull against the visible area
+struct WorldBounds {
+    float minX = 0.0f, minY = 0.0f;
+    float maxX = 0.0f, maxY = 0.0f;
+    
+    // True if a square of the given half extent centered on (x, y) touches the bounds
+    bool overlaps(float x, float y, float halfExtent) const {
+        return x + halfExtent >= minX && x - halfExtent <= maxX &&
+               y + halfExtent >= minY && y - halfExtent <= maxY;
+    }
+};
+
 class View {
 public:
     static View& getInstance();
@@ -8,12 +20,20 @@ public:
     void setCenter(float x, float y);
     void getCenter(float& x, float& y) const;
     
+    // Render interpolation: remember the center at the start of a fixed step so
+    // render snapshots can blend between the previous and current step
+    void storePrevious();
+    void getPreviousCenter(float& x, float& y) const;
+    
     // Transform world coordinates to screen coordinates
     SDL_Rect worldToScreen(const SDL_Rect& worldRect) const;
     
     // Transform screen coordinates to world coordinates
     void screenToWorld(int screenX, int screenY, float& worldX, float& worldY) const;
     
+    // World-space area covered by the window at the current center and scale
+    WorldBounds getVisibleBounds() const;
+    
     // Optional: scale and rotation
     void setScale(float s) { scale = s; }
     float getScale() const { return scale; }
@@ -26,5 +46,7 @@ private:
     
     float centerX = 0.0f;
     float centerY = 0.0f;
+    float prevCenterX = 0.0f;
+    float prevCenterY = 0.0f;
     float scale = 1.0f;
 };
@@ -1,22 +1,68 @@
 #include "Engine.h"
 #include "AssetManager.h"
 #include "Settings.h"
+#include "FrameProfiler.h"
+#include "InputRecorder.h"
+#include "JobSystem.h"
+#include "CollisionLayers.h"
+#include "PhysicsProfiler.h"
+#include <cstdlib>
+#include <ctime>
 #include <iostream>
 
-int main() {
+int main(int argc, char* argv[]) {
 
     Settings settings; // defaults populated
     loadSettingsFromXML("assets/config.xml", settings); // ignore failure, defaults remain
+    applyCommandLine(argc, argv, settings);
+    
+    // A replay carries the seed, fixed step and window size it was recorded with
+    if (!settings.replayInputPath.empty()) {
+        if (!InputRecorder::getInstance().startReplay(settings.replayInputPath)) {
+            return -1;
+        }
+        const InputRecordingHeader& recorded = InputRecorder::getInstance().getHeader();
+        settings.seed = recorded.seed;
+        settings.logicFPS = recorded.logicFPS;
+        settings.width = recorded.windowWidth;
+        settings.height = recorded.windowHeight;
+        if (!settings.recordInputPath.empty()) {
+            std::cerr << "Ignoring --record while replaying" << std::endl;
+            settings.recordInputPath.clear();
+        }
+    }
+    if (settings.seed == 0) {
+        settings.seed = static_cast<unsigned int>(std::time(nullptr));
+    }
+    std::srand(settings.seed);
+    std::cout << "Random seed: " << settings.seed << std::endl;
+    
+    if (!settings.recordInputPath.empty()) {
+        InputRecordingHeader header;
+        header.seed = settings.seed;
+        header.logicFPS = settings.logicFPS;
+        header.windowWidth = settings.width;
+        header.windowHeight = settings.height;
+        InputRecorder::getInstance().startRecording(settings.recordInputPath, header);
+    }
 
+    JobSystem::getInstance().start(settings.jobWorkers);
+    std::cout << "Job system: " << JobSystem::getInstance().getWorkerCount() << " worker thread(s)" << std::endl;
+    
     Engine& engine = Engine::getInstance();
     
-    if (!engine.init("Bare Minimum Game", settings.width, settings.height)) {
+    if (!engine.init("Bare Minimum Game", settings.width, settings.height, settings.headless)) {
         std::cerr << "Failed to initialize engine!" << std::endl;
         return -1;
     }
     
     Engine::setTargetFPS(settings.renderFPS);
     Engine::setLogicFPS(settings.logicFPS);
+    Engine::setTimeScale(settings.timeScale);
+    engine.setMaxTicks(settings.maxTicks);
+    engine.setSimulationThread(settings.simulationThread);
+    engine.setMaxStepsPerFrame(settings.maxStepsPerFrame);
+    engine.setSoftParticles(settings.softParticles);
     
     // Load assets first (textures need to be loaded before game objects)
     AssetManager::getInstance().loadFromXML("assets/config.xml");
@@ -25,15 +71,35 @@ int main() {
     AssetManager::getInstance().setVolume("explosion", settings.explosionVolume);
     AssetManager::getInstance().setVolume("rocket", settings.rocketVolume);
     
+    // Collision layers before any body is configured
+    CollisionLayers::loadFromXML("assets/config.xml");
+    
     // Load game objects (now textures are available for aspect ratio queries)
     engine.loadGameObjectsFromXML("assets/config.xml");
     
+    if (settings.profile) {
+        FrameProfiler::getInstance().setWindowSize(static_cast<size_t>(settings.profileWindow));
+        PhysicsProfiler::getInstance().setWindowSize(static_cast<size_t>(settings.profileWindow));
+        FrameProfiler::getInstance().setEnabled(true);
+    }
+    
     std::cout << "Starting game loop..." << std::endl;
     engine.run();
+    InputRecorder::getInstance().close();
+    
+    if (settings.profile) {
+        FrameProfiler::getInstance().printSummary(Engine::getTargetFPS() > 0 ? 1000.0 / Engine::getTargetFPS() : 0.0,
+                                                  1000.0 / settings.logicFPS);
+        PhysicsProfiler::getInstance().printSummary();
+        FrameProfiler::getInstance().writeCSV(settings.profileCSV);
+        PhysicsProfiler::getInstance().appendCSV(settings.profileCSV);
+        engine.printPoolStats();
+    }
     
     // Cleanup
     AssetManager::getInstance().clean();
     engine.clean();
+    JobSystem::getInstance().shutdown();
     
     return 0;
 }
\ No newline at end of file